@@ -63,7 +63,7 @@
 
 		configuration "linux"
 			defines     { "LUA_USE_LINUX" }
-			links       { "m", "dl" } 
+			links       { "m", "dl", "pthread" } 
 			
 		configuration "macosx"
 			defines     { "LUA_USE_MACOSX" }
@@ -110,6 +110,20 @@
 	}
 
 
+--
+-- Use the benchmark action to time the current build on a set of generated
+-- solutions, and to compare the results against a saved baseline.
+--
+
+	dofile("scripts/benchmark.lua")
+	
+	newaction {
+		trigger     = "benchmark",
+		description = "Time Premake on generated solutions; see scripts/benchmark.lua",
+		execute     = dobenchmark
+	}
+
+
 --
 -- Use the release action to prepare source and binary packages for a new release.
 -- This action isn't complete yet; a release still requires some manual work.
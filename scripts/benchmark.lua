@@ -0,0 +1,397 @@
+--
+-- Benchmark Premake against generated solutions of different shapes. Each
+-- case is written out as a project script, and then every action is run on
+-- it by a separate Premake executable; the wall time, peak script memory,
+-- and time taken by each phase are recorded. The results can be saved as a
+-- baseline, and later results compared against it.
+--
+--   premake4 [--bench-save=FILE] [--bench-compare=FILE] benchmark [case ...]
+--
+
+	newoption {
+		trigger     = "bench-compare",
+		value       = "FILE",
+		description = "Compare benchmark results to a baseline saved in FILE"
+	}
+
+	newoption {
+		trigger     = "bench-premake",
+		value       = "PATH",
+		description = "The Premake executable to benchmark; default is bin/release/premake4"
+	}
+
+	newoption {
+		trigger     = "bench-runs",
+		value       = "N",
+		description = "Run each benchmark N times and keep the fastest; default is 3"
+	}
+
+	newoption {
+		trigger     = "bench-save",
+		value       = "FILE",
+		description = "Save the benchmark results to FILE, as a baseline"
+	}
+
+	newoption {
+		trigger     = "bench-threshold",
+		value       = "PCT",
+		description = "Flag results more than PCT percent worse than the baseline; default is 10"
+	}
+
+
+	local benchdir = "build/benchmark"
+
+	local actions = { "gmake", "vs2008", "xcode3", "codeblocks", "codelite" }
+
+
+--
+-- The cases. Each one starts from the defaults and changes one or two of
+-- them, so a regression can be pinned on what the case scales up.
+--
+--   projects    the number of projects in the solution
+--   files       the number of source files in each project
+--   configs     the number of build configurations
+--   platforms   the number of platforms, in addition to Native
+--   blocks      the number of configuration blocks in each project
+--   fileblocks  the number of configuration { files = ... } blocks in each project
+--   ondisk      if set, the files are created and found with "**" wildcards
+--
+
+	local defaults = {
+		projects   = 20,
+		files      = 50,
+		configs    = 2,
+		platforms  = 0,
+		blocks     = 2,
+		fileblocks = 0,
+	}
+
+	local cases = {
+		{ name = "baseline"   },
+		{ name = "projects",   projects = 500 },
+		{ name = "files",      files = 2000 },
+		{ name = "configs",    configs = 8, platforms = 2 },
+		{ name = "blocks",     blocks = 50 },
+		{ name = "fileblocks", fileblocks = 20, files = 500 },
+		{ name = "glob",       files = 500, ondisk = true },
+	}
+
+
+
+--
+-- Writes out the project script for a case, and any files it should find
+-- on the disk. Files are spread over ten directories in each project.
+--
+
+	local function touch(fname)
+		local f = io.open(fname, "w")
+		f:close()
+	end
+
+	local function writecase(case, dir)
+		local lines = { }
+		local function add(fmt, ...)
+			table.insert(lines, string.format(fmt, unpack(arg)))
+		end
+
+		local configs = { }
+		for i = 1, case.configs do
+			table.insert(configs, string.format('"Config%d"', i))
+		end
+		local platforms = { '"Native"' }
+		local allplatforms = { "x32", "x64", "Universal", "Universal32", "Universal64" }
+		for i = 1, case.platforms do
+			table.insert(platforms, string.format('"%s"', allplatforms[i]))
+		end
+
+		add('solution "Benchmark"')
+		add('\tconfigurations { %s }', table.concat(configs, ", "))
+		add('\tplatforms { %s }', table.concat(platforms, ", "))
+		add('\tlocation "build"')
+
+		for p = 1, case.projects do
+			add('project "Project%d"', p)
+			add('\tkind "StaticLib"')
+			add('\tlanguage "C++"')
+			if case.ondisk then
+				for d = 1, 10 do
+					os.mkdir(string.format("%s/src/p%d/dir%d", dir, p, d))
+				end
+				for f = 1, case.files do
+					touch(string.format("%s/src/p%d/dir%d/file%d.cpp", dir, p, f % 10 + 1, f))
+				end
+				add('\tfiles { "src/p%d/**.cpp" }', p)
+			else
+				add('\tfiles {')
+				for f = 1, case.files do
+					add('\t\t"src/p%d/dir%d/file%d.cpp",', p, f % 10 + 1, f)
+				end
+				add('\t}')
+			end
+
+			for b = 1, case.blocks do
+				add('\tconfiguration "Config%d"', (b - 1) % case.configs + 1)
+				add('\t\tdefines { "BLOCK%d" }', b)
+				add('\t\tincludedirs { "include/block%d" }', b)
+			end
+
+			for b = 1, case.fileblocks do
+				add('\tconfiguration { files = "src/p%d/dir%d/**" }', p, (b - 1) % 10 + 1)
+				add('\t\tdefines { "FILEBLOCK%d" }', b)
+			end
+		end
+
+		local f = io.open(dir .. "/premake4.lua", "w")
+		f:write(table.concat(lines, "\n"))
+		f:write("\n")
+		f:close()
+	end
+
+
+
+--
+-- A small JSON reader and writer, enough for the results files.
+--
+
+	local function encode(value, indent)
+		indent = indent or ""
+		if type(value) == "number" then
+			return string.format("%.6g", value)
+		elseif type(value) == "boolean" then
+			return tostring(value)
+		elseif type(value) == "string" then
+			return '"' .. value:gsub('[%c"\\]', function(c) return string.format("\\u%04x", c:byte()) end) .. '"'
+		end
+
+		local inner = indent .. "\t"
+		local items = { }
+		if #value > 0 then
+			for _, v in ipairs(value) do
+				table.insert(items, inner .. encode(v, inner))
+			end
+			return "[\n" .. table.concat(items, ",\n") .. "\n" .. indent .. "]"
+		end
+		for k, v in table.sortedpairs(value) do
+			table.insert(items, inner .. encode(k) .. ": " .. encode(v, inner))
+		end
+		return "{\n" .. table.concat(items, ",\n") .. "\n" .. indent .. "}"
+	end
+
+	local function decode(s)
+		local pos = 1
+
+		local function skip()
+			pos = s:find("[^%s]", pos) or #s + 1
+		end
+
+		local function fail()
+			error(string.format("bad JSON at character %d", pos), 0)
+		end
+
+		local value
+		function value()
+			skip()
+			local c = s:sub(pos, pos)
+			if c == "{" or c == "[" then
+				local result = { }
+				local close = iif(c == "{", "}", "]")
+				pos = pos + 1
+				skip()
+				if s:sub(pos, pos) == close then
+					pos = pos + 1
+					return result
+				end
+				repeat
+					if c == "{" then
+						local k = value()
+						skip()
+						if s:sub(pos, pos) ~= ":" then fail() end
+						pos = pos + 1
+						result[k] = value()
+					else
+						table.insert(result, value())
+					end
+					skip()
+					local sep = s:sub(pos, pos)
+					pos = pos + 1
+				until sep ~= ","
+				if s:sub(pos - 1, pos - 1) ~= close then fail() end
+				return result
+			elseif c == '"' then
+				local finish = s:find('"', pos + 1, true) or fail()
+				local str = s:sub(pos + 1, finish - 1):gsub("\\u(%x%x%x%x)", function(h) return string.char(tonumber(h, 16)) end)
+				pos = finish + 1
+				return str
+			elseif s:find("^true", pos) then
+				pos = pos + 4
+				return true
+			elseif s:find("^false", pos) then
+				pos = pos + 5
+				return false
+			else
+				local num = s:match("^-?[%d%.eE%+%-]+", pos) or fail()
+				pos = pos + #num
+				return tonumber(num)
+			end
+		end
+
+		return value()
+	end
+
+
+
+--
+-- Runs one action on one case, and returns the fastest of the runs: the
+-- wall time in milliseconds, the peak script memory in kilobytes, and the
+-- milliseconds spent in each phase, read back from the --trace output.
+--
+
+	local function readfile(fname)
+		local f = io.open(fname, "rb")
+		if not f then return nil end
+		local s = f:read("*a")
+		f:close()
+		return s
+	end
+
+	local function runonce(premake, dir, action)
+		local log = dir .. "/" .. action .. ".log"
+		local trace = dir .. "/" .. action .. ".json"
+		local cmd = string.format('%s --file=%s/premake4.lua --trace=%s --allocstats %s > %s 2>&1',
+			premake, dir, trace, action, log)
+
+		local start = os.ticks()
+		local ok = (os.execute(cmd) == 0)
+		local result = { wall = (os.ticks() - start) / 1000 }
+
+		local output = readfile(log) or ""
+		if not ok or not output:find("Done.", 1, true) then
+			result.error = output:match("[^\n]*Error[^\n]*") or "failed"
+			return result
+		end
+
+		result.peak = tonumber(output:match("(%d+) KB peak"))
+		result.phases = { }
+		local stack = { }
+		for _, e in ipairs(decode(readfile(trace)).traceEvents) do
+			if e.ph == "B" then
+				table.insert(stack, e)
+			elseif e.ph == "E" then
+				local b = table.remove(stack)
+				if b.cat == "phase" then
+					result.phases[b.name] = (e.ts - b.ts) / 1000
+				end
+			end
+		end
+		return result
+	end
+
+	local function runcase(premake, case, action, runs)
+		local best
+		for i = 1, runs do
+			local result = runonce(premake, benchdir .. "/" .. case.name, action)
+			if result.error then
+				return result
+			end
+			if not best or result.wall < best.wall then
+				best = result
+			end
+		end
+		return best
+	end
+
+
+
+--
+-- Compares results to a baseline, printing both and the change, and
+-- returns the number of results which got worse by more than the threshold.
+--
+
+	local function compare(results, baseline, threshold)
+		local old = { }
+		for _, r in ipairs(baseline.results) do
+			old[r.case .. "/" .. r.action] = r
+		end
+
+		local regressions = 0
+		printf("%-24s%12s%12s%9s%12s%12s%9s", "", "wall ms", "was", "", "peak KB", "was", "")
+		for _, r in ipairs(results) do
+			local o = old[r.case .. "/" .. r.action]
+			if o and not r.error and not o.error then
+				local flags = ""
+				local function change(new, was)
+					local pct = (was > 0) and (new - was) * 100 / was or 0
+					if pct > threshold then
+						flags = " REGRESSION"
+					end
+					return string.format("%+8.1f%%", pct)
+				end
+				local walls = change(r.wall, o.wall)
+				local peaks = change(r.peak or 0, o.peak or 0)
+				if flags ~= "" then
+					regressions = regressions + 1
+				end
+				printf("%-24s%12.1f%12.1f%s%12d%12d%s%s", r.case .. "/" .. r.action, r.wall, o.wall, walls, r.peak or 0, o.peak or 0, peaks, flags)
+			end
+		end
+		return regressions
+	end
+
+
+
+	function dobenchmark()
+		local premake = _OPTIONS["bench-premake"] or "bin/release/premake4"
+		local runs = tonumber(_OPTIONS["bench-runs"] or 3)
+		local threshold = tonumber(_OPTIONS["bench-threshold"] or 10)
+
+		-- pick out the cases listed on the command line, or run them all
+		local selected = { }
+		for _, case in ipairs(cases) do
+			if #_ARGS == 0 or table.contains(_ARGS, case.name) then
+				for k, v in pairs(defaults) do
+					case[k] = case[k] or v
+				end
+				table.insert(selected, case)
+			end
+		end
+
+		local results = { }
+		for _, case in ipairs(selected) do
+			local dir = benchdir .. "/" .. case.name
+			os.rmdir(dir)
+			os.mkdir(dir)
+			writecase(case, dir)
+
+			for _, action in ipairs(actions) do
+				local r = runcase(premake, case, action, runs)
+				r.case = case.name
+				r.action = action
+				table.insert(results, r)
+
+				if r.error then
+					printf("%-24s failed: %s", case.name .. "/" .. action, r.error)
+				else
+					local phases = { }
+					for name, ms in table.sortedpairs(r.phases) do
+						table.insert(phases, string.format("%s %.1f", name, ms))
+					end
+					printf("%-24s%10.1f ms%10d KB   %s", case.name .. "/" .. action, r.wall, r.peak or 0, table.concat(phases, ", "))
+				end
+			end
+		end
+
+		if _OPTIONS["bench-save"] then
+			local f = io.open(_OPTIONS["bench-save"], "w")
+			f:write(encode({ premake = premake, runs = runs, results = results }))
+			f:write("\n")
+			f:close()
+		end
+
+		if _OPTIONS["bench-compare"] then
+			local baseline = decode(readfile(_OPTIONS["bench-compare"]) or error("unable to read " .. _OPTIONS["bench-compare"], 0))
+			local regressions = compare(results, baseline, threshold)
+			if regressions > 0 then
+				error(string.format("%d result(s) worse than the baseline by more than %d%%", regressions, threshold), 0)
+			end
+		end
+	end
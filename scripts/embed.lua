@@ -2,10 +2,19 @@
 -- Embed the Lua scripts into src/host/scripts.c as static data buffers.
 -- I embed the actual scripts, rather than Lua bytecodes, because the 
 -- bytecodes are not portable to different architectures, which causes 
--- issues in Mac OS X Universal builds.
+-- issues in Mac OS X Universal builds. With --bytecode, precompiled
+-- bytecodes are embedded as well, along with the Lua header they were
+-- built for; the host only uses them if that header matches its own, and
+-- falls back to the scripts otherwise.
 --
 
-	local function embedfile(out, fname)
+	newoption {
+		trigger     = "bytecode",
+		description = "Also embed precompiled bytecode, for faster startup"
+	}
+
+
+	local function readscript(fname)
 		local f = io.open(fname)
 		local s = f:read("*a")
 		f:close()
@@ -19,15 +28,22 @@
 		-- strip out comments
 		s = s:gsub("\n%-%-[^\n]*", "")
 				
-		-- escape backslashes
-		s = s:gsub("\\", "\\\\")
-
 		-- strip duplicate line feeds
 		s = s:gsub("\n+", "\n")
 
 		-- strip out leading comments
 		s = s:gsub("^%-%-\n", "")
 
+		return s
+	end
+
+
+	local function embedfile(out, fname)
+		local s = readscript(fname)
+
+		-- escape backslashes
+		s = s:gsub("\\", "\\\\")
+
 		-- escape line feeds
 		s = s:gsub("\n", "\\n")
 		
@@ -40,6 +56,27 @@
 	end
 
 
+	-- writes binary data as a C string; every escape is a full three digit
+	-- octal code, so it can't run into the character after it
+	local function writebytes(out, s, indent)
+		for i = 1, #s, 32 do
+			local line = s:sub(i, i + 31):gsub("[%z\1-\31\127-\255\\\"%?]", function(c)
+				return string.format("\\%03o", c:byte())
+			end)
+			out:write(indent .. "\"" .. line .. "\"\n")
+		end
+	end
+
+
+	local function embedbytecode(out, fname, name)
+		local fn = assert(loadstring(readscript(fname), name))
+		local s = string.dump(fn)
+		out:write("\t{ \"" .. name .. "\", " .. #s .. ",\n")
+		writebytes(out, s, "\t\t")
+		out:write("\t},\n")
+	end
+
+
 	function doembed()
 			-- load the manifest of script files
 			scripts = dofile("src/_manifest.lua")
@@ -50,6 +87,7 @@
 			out:write("/* Premake's Lua scripts, as static data buffers for release mode builds */\n")
 			out:write("/* DO NOT EDIT - this file is autogenerated - see BUILD.txt */\n")
 			out:write("/* To regenerate this file, run: premake4 embed */ \n\n")
+			out:write("#include \"premake.h\"\n\n")
 			out:write("const char* builtin_scripts[] = {\n")
 			
 			for i,fn in ipairs(scripts) do
@@ -57,6 +95,45 @@
 				s = embedfile(out, "src/"..fn)
 			end
 			
-			out:write("\t0\n};\n");		
+			out:write("\t0\n};\n\n");
+			
+			-- the action modules are only loaded on demand, so they are stored
+			-- by name, along with the manifest which lists them
+			out:write("const char* builtin_modules[] = {\n")
+			local modules = { "_manifest.lua" }
+			for _, m in ipairs(scripts.modules) do
+				for _, fn in ipairs(m) do
+					table.insert(modules, fn)
+				end
+			end
+			
+			for i,fn in ipairs(modules) do
+				print(fn)
+				out:write("\t\"" .. fn .. "\",\n")
+				s = embedfile(out, "src/"..fn)
+			end
+
+			out:write("\t0\n};\n\n");
+			
+			-- the bytecodes, if requested: the scripts, then the modules, in the
+			-- same order as above. The header is empty if there are none.
+			out:write("const char builtin_bytecode_header[] =\n")
+			if _OPTIONS["bytecode"] then
+				writebytes(out, string.dump(loadstring("")):sub(1, 12), "\t")
+			else
+				out:write("\t\"\"\n")
+			end
+			out:write("\t;\n\n")
+
+			out:write("const BuiltinChunk builtin_bytecode[] = {\n")
+			if _OPTIONS["bytecode"] then
+				for i,fn in ipairs(scripts) do
+					embedbytecode(out, "src/"..fn, fn)
+				end
+				for i,fn in ipairs(modules) do
+					embedbytecode(out, "src/"..fn, fn)
+				end
+			end
+			out:write("\t{ 0, 0, 0 }\n};\n");
 			out:close()
 	end
@@ -5,7 +5,8 @@
 --
 
 -- The master list of built-in scripts. Order is important! If you want to
--- build a new script into Premake, add it to this list.
+-- build a new script into Premake, add it to this list. These are loaded
+-- every time Premake runs.
 
 	return
 	{
@@ -15,6 +16,8 @@
 		"base/table.lua",
 		"base/io.lua",
 		"base/globals.lua",
+		"base/trace.lua",
+		"base/memstats.lua",
 		"base/action.lua",
 		"base/option.lua",
 		"base/tree.lua",
@@ -29,29 +32,57 @@
 		"base/validate.lua",
 		"base/help.lua",
 		"base/premake.lua",
-		"actions/codeblocks/codeblocks_workspace.lua",
-		"actions/codeblocks/codeblocks_cbp.lua",
-		"actions/codeblocks/_codeblocks.lua",
-		"actions/codelite/codelite_workspace.lua",
-		"actions/codelite/codelite_project.lua",
-		"actions/codelite/_codelite.lua",
-    "actions/qmake/_qmake.lua",
-    "actions/qmake/qmake_pro.lua",
-    "actions/qmake/qmake_subdirs.lua",
-		"actions/make/make_solution.lua",
-		"actions/make/make_cpp.lua",
-		"actions/make/make_csharp.lua",
-		"actions/make/_make.lua",
-		"actions/vstudio/vs2002_solution.lua",
-		"actions/vstudio/vs2002_csproj.lua",
-		"actions/vstudio/vs2002_csproj_user.lua",
-		"actions/vstudio/vs200x_vcproj.lua",
-		"actions/vstudio/vs2003_solution.lua",
-		"actions/vstudio/vs2005_solution.lua",
-		"actions/vstudio/vs2005_csproj.lua",
-		"actions/vstudio/vs2005_csproj_user.lua",
-		"actions/vstudio/_vstudio.lua",
-		"actions/xcode/_xcode.lua",
-		"actions/xcode/xcode_pbxproj.lua",
 		"actions/clean/_clean.lua",
+
+		-- The actions, which are only loaded when one of the listed triggers is
+		-- chosen, or when all of the actions have to be listed. A module which
+		-- uses another's functions names that action in "requires".
+		modules =
+		{
+			{
+				triggers = { "codeblocks" },
+				requires = "gmake",
+				"actions/codeblocks/codeblocks_workspace.lua",
+				"actions/codeblocks/codeblocks_cbp.lua",
+				"actions/codeblocks/_codeblocks.lua",
+			},
+			{
+				triggers = { "codelite" },
+				requires = "gmake",
+				"actions/codelite/codelite_workspace.lua",
+				"actions/codelite/codelite_project.lua",
+				"actions/codelite/_codelite.lua",
+			},
+			{
+				triggers = { "qmake" },
+				requires = "gmake",
+				"actions/qmake/_qmake.lua",
+				"actions/qmake/qmake_pro.lua",
+				"actions/qmake/qmake_subdirs.lua",
+			},
+			{
+				triggers = { "gmake" },
+				"actions/make/make_solution.lua",
+				"actions/make/make_cpp.lua",
+				"actions/make/make_csharp.lua",
+				"actions/make/_make.lua",
+			},
+			{
+				triggers = { "vs2002", "vs2003", "vs2005", "vs2008" },
+				"actions/vstudio/vs2002_solution.lua",
+				"actions/vstudio/vs2002_csproj.lua",
+				"actions/vstudio/vs2002_csproj_user.lua",
+				"actions/vstudio/vs200x_vcproj.lua",
+				"actions/vstudio/vs2003_solution.lua",
+				"actions/vstudio/vs2005_solution.lua",
+				"actions/vstudio/vs2005_csproj.lua",
+				"actions/vstudio/vs2005_csproj_user.lua",
+				"actions/vstudio/_vstudio.lua",
+			},
+			{
+				triggers = { "xcode3" },
+				"actions/xcode/_xcode.lua",
+				"actions/xcode/xcode_pbxproj.lua",
+			},
+		},
 	}
@@ -8,6 +8,8 @@
 	local scriptfile    = "premake4.lua"
 	local shorthelp     = "Type 'premake4 --help' for help"
 	local versionhelp   = "premake4 (Premake Build Script Generator) %s"
+	local globcachefile = ".premake/globcache"
+	local scriptcachedir = ".premake/cache"
 	
 
 
@@ -45,6 +47,20 @@
 	end
 	
 
+--
+-- Write out the directory listings cached while matching files, if any
+-- have changed; the .premake folder is created the first time.
+--
+
+	local function saveglobcache()
+		local cachefile = premake.globcache
+		if cachefile and os.saveglobcache(cachefile) == nil then
+			os.mkdir(path.getdirectory(cachefile))
+			os.saveglobcache(cachefile)
+		end
+	end
+	
+
 --
 -- Script-side program entry point.
 --
@@ -53,15 +69,35 @@
 		
 		-- if running off the disk (in debug mode), load everything 
 		-- listed in _manifest.lua; the list divisions make sure
-		-- everything gets initialized in the proper order.
+		-- everything gets initialized in the proper order. The action
+		-- modules are left until they are needed; in release mode the
+		-- host provides them.
 		
 		if (scriptpath) then
 			local scripts  = dofile(scriptpath .. "/_manifest.lua")
 			for _,v in ipairs(scripts) do
 				dofile(scriptpath .. "/" .. v)
 			end
+			premake.action.addmodules(scripts.modules, function(fname)
+				return loadfile(scriptpath .. "/" .. fname)
+			end)
+		else
+			local scripts = _loadbuiltin("_manifest.lua")()
+			premake.action.addmodules(scripts.modules, _loadbuiltin)
+		end
+		
+
+		-- Start recording the trace and memory use, if requested
+
+		if _OPTIONS["trace"] then
+			premake.trace.start()
 		end
 		
+		if _OPTIONS["memstats"] then
+			premake.memstats.start()
+			premake.memstats.sample("startup")
+		end
+
 
 		-- Set up the environment for the chosen action early, so side-effects
 		-- can be picked up by the scripts.
@@ -77,9 +113,25 @@
 		-- If there is a project script available, run it to get the
 		-- project information, available options and actions, etc.
 		
+		-- The caches are kept beside the script, and only for runs which go on
+		-- to an action; a help or version request leaves nothing behind.
+		
 		local fname = _OPTIONS["file"] or scriptfile
 		if (os.isfile(fname)) then
+			local scriptdir = path.getdirectory(path.getabsolute(fname))
+			local usecache = _ACTION and not _OPTIONS["help"] and not _OPTIONS["version"]
+			if usecache and not _OPTIONS["no-glob-cache"] then
+				premake.globcache = path.join(scriptdir, globcachefile)
+				os.loadglobcache(premake.globcache)
+			end
+			if usecache and not _OPTIONS["no-script-cache"] then
+				premake.scriptcache = path.join(scriptdir, scriptcachedir)
+			end
+			premake.trace.begin("load scripts", "phase")
 			dofile(fname)
+			premake.trace.finish()
+			premake.memstats.sample("load scripts")
+			saveglobcache()
 		end
 
 
@@ -122,6 +174,11 @@
 		ok, err = premake.option.validate(_OPTIONS)
 		if (not ok) then error("Error: " .. err, 0) end
 		
+		-- the memory figures are for this one process
+		if _OPTIONS["memstats"] and (tonumber(_OPTIONS["jobs"]) or 1) > 1 then
+			error("Error: --memstats can't be used with --jobs", 0)
+		end
+		
 
 		-- Sanity check the current project setup
 
@@ -137,15 +194,41 @@
 		
 		-- work-in-progress: build the configurations
 		print("Building configurations...")
+		premake.trace.begin("buildconfigs", "phase")
 		premake.buildconfigs()
+		premake.trace.finish()
+		premake.memstats.sample("buildconfigs")
 		
+		premake.trace.begin("checkprojects", "phase")
 		ok, err = premake.checkprojects()
+		premake.trace.finish()
+		premake.memstats.sample("checkprojects")
 		if (not ok) then error("Error: " .. err, 0) end
 		
 		
 		-- Hand over control to the action
 		printf("Running action '%s'...", action.trigger)
-		premake.action.call(action.trigger)
+		premake.trace.begin(action.trigger, "phase")
+		if _OPTIONS["verify-stable"] then
+			ok, err = premake.verifystable(action.trigger)
+			if (not ok) then error("Error: " .. err, 0) end
+		else
+			premake.action.call(action.trigger, tonumber(_OPTIONS["jobs"]))
+		end
+		premake.trace.finish()
+		premake.memstats.sample(action.trigger)
+		saveglobcache()
+
+		if _OPTIONS["trace"] then
+			ok, err = premake.trace.save(_OPTIONS["trace"])
+			if (not ok) then error("Error: " .. err, 0) end
+			premake.trace.stop()
+		end
+		
+		if _OPTIONS["memstats"] then
+			premake.memstats.report()
+			premake.memstats.stop()
+		end
 
 		print("Done.")
 		return 0
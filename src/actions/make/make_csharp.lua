@@ -138,10 +138,10 @@
 		_p('')
 
 		_p('COPYFILES += \\')
-		for target, source in pairs(cfgpairs[anycfg]) do
+		for target, source in table.sortedpairs(cfgpairs[anycfg]) do
 			_p('\t%s \\', target)
 		end
-		for target, source in pairs(copypairs) do
+		for target, source in table.sortedpairs(copypairs) do
 			_p('\t%s \\', target)
 		end
 		_p('')
@@ -184,10 +184,10 @@
 		_p('\t$(SILENT) rm -rf $(OBJDIR)')
 		_p('else')
 		_p('\t$(SILENT) if exist $(subst /,\\\\,$(TARGETDIR)/%s.*) del $(subst /,\\\\,$(TARGETDIR)/%s.*)', prj.buildtarget.basename, prj.buildtarget.basename)
-		for target, source in pairs(cfgpairs[anycfg]) do
+		for target, source in table.sortedpairs(cfgpairs[anycfg]) do
 			_p('\t$(SILENT) if exist $(subst /,\\\\,%s) del $(subst /,\\\\,%s)', target, target)
 		end
-		for target, source in pairs(copypairs) do
+		for target, source in table.sortedpairs(copypairs) do
 			_p('\t$(SILENT) if exist $(subst /,\\\\,%s) del $(subst /,\\\\,%s)', target, target)
 		end
 		_p('\t$(SILENT) if exist $(subst /,\\\\,$(OBJDIR)) rmdir /s /q $(subst /,\\\\,$(OBJDIR))')
@@ -207,7 +207,7 @@
 		_p('# Per-configuration copied file rules')
 		for cfg in premake.eachconfig(prj) do
 			_p('ifneq (,$(findstring %s,$(config)))', _MAKE.esc(cfg.name:lower()))
-			for target, source in pairs(cfgpairs[cfg]) do
+			for target, source in table.sortedpairs(cfgpairs[cfg]) do
 				premake.make_copyrule(source, target)
 			end
 			_p('endif')
@@ -215,7 +215,7 @@
 		end
 		
 		_p('# Copied file rules')
-		for target, source in pairs(copypairs) do
+		for target, source in table.sortedpairs(copypairs) do
 			premake.make_copyrule(source, target)
 		end
 
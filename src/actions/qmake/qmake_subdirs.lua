@@ -20,7 +20,7 @@
     local includes = {}
     for proj in premake.eachproject(sln) do
       local cc = premake.gettool(proj)
-      for platform_name,_ in pairs(cc.platforms) do
+      for platform_name,_ in table.sortedpairs(cc.platforms) do
         for cfg in premake.eachconfig(proj, platform_name) do
           for _,v in ipairs(cfg.includedirs) do
             dir = path.getabsolute(proj.location .. '/' .. v)
@@ -29,7 +29,7 @@
         end
       end
     end
-    for dir in pairs(includes) do
+    for dir in table.sortedpairs(includes) do
       _p("%s", dir)
     end
   end
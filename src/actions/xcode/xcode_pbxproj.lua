@@ -116,7 +116,7 @@
 		-- also assign solution-level configuration IDs
 		tr.configids = {}
 		for _, cfgname in ipairs(sln.configurations) do
-			tr.configids[cfgname] = xcode.newid(node, cfgname)
+			tr.configids[cfgname] = xcode.newid(tr, cfgname)
 		end
 		
 		-- Final setup
@@ -261,16 +261,43 @@
 
 
 --
--- Retrieves a unique 12 byte ID for an object. This function accepts and ignores two
--- parameters 'node' and 'usage', which are used by an alternative implementation of
--- this function for testing.
+-- Retrieves a unique 12 byte ID for an object. The ID is derived from the node's
+-- place in the tree and its usage, so an unchanged solution gets the same IDs, and
+-- the same project file, every time it is generated. Nodes which would otherwise
+-- share an ID are numbered in the order they are seen.
 --
+-- @param node
+--    The tree node the ID is for.
+-- @param usage
+--    An optional string to tell apart the different IDs used by one node.
 -- @returns
 --    A 24-character string representing the 12 byte ID.
 --
 
-	function xcode.newid()
-		return string.format("%04X%04X%04X%012d", math.random(0, 32767), math.random(0, 32767), math.random(0, 32767), os.time())
+	local usedids = setmetatable({ }, { __mode = "k" })
+
+	function xcode.newid(node, usage)
+		local name = node.name .. ":" .. (usage or "")
+		local root = node
+		while root.parent do
+			root = root.parent
+			name = root.name .. "/" .. name
+		end
+
+		-- IDs only need to be unique within one tree
+		local used = usedids[root]
+		if not used then
+			used = { }
+			usedids[root] = used
+		end
+
+		local count = used[name]
+		used[name] = (count or 0) + 1
+		if count then
+			name = name .. "(" .. count .. ")"
+		end
+
+		return os.uuid(name):gsub("-", ""):sub(1, 24)
 	end
 
 
@@ -12,6 +12,14 @@
 --
 
 	premake.action.list = { }
+
+
+--
+-- The actions which are loaded on demand, keyed by trigger; see the list of
+-- modules in _manifest.lua.
+--
+
+	premake.action.modules = { }
 	
 
 --
@@ -39,18 +47,244 @@
 	end
 
 
+--
+-- Register a list of action modules, which are not loaded until one of their
+-- actions is needed.
+--
+-- @param modules
+--    A list of modules, each a list of script names with the triggers it
+--    provides and, optionally, the trigger of another module it requires.
+-- @param loader
+--    A function which compiles a script, given its name, like loadfile().
+--
+
+	function premake.action.addmodules(modules, loader)
+		for _, m in ipairs(modules) do
+			m.loader = loader
+			for _, trigger in ipairs(m.triggers) do
+				premake.action.modules[trigger] = m
+			end
+		end
+	end
+
+
+--
+-- Load the module which provides an action, if it hasn't been loaded already.
+--
+-- @param name
+--    The trigger of the action to load.
+--
+
+	function premake.action.load(name)
+		local m = premake.action.modules[name]
+		if m and not m.loaded then
+			m.loaded = true
+			if m.requires then
+				premake.action.load(m.requires)
+			end
+			for _, fname in ipairs(m) do
+				local fn, err = m.loader(fname)
+				if not fn then
+					error(err, 0)
+				end
+				fn()
+			end
+		end
+	end
+
+
+--
+-- Load every action module, for when all of the actions must be listed.
+--
+
+	function premake.action.loadall()
+		for name in table.sortedpairs(premake.action.modules) do
+			premake.action.load(name)
+		end
+	end
+
+
+--
+-- Make a list of calls, capturing what they print and stopping at the first
+-- error; returns the output and any error of each, keyed by the call's place
+-- in the list.
+--
+
+	local function callshare(calls, share)
+		local results = { }
+		local builtin_print = print
+		for _, i in ipairs(share) do
+			local output = { }
+			print = function(s)
+				table.insert(output, tostring(s))
+			end
+			local ok, err = pcall(calls[i][1], calls[i][2])
+			print = builtin_print
+			results[i] = { output = table.concat(output, "\n"), err = (not ok) and tostring(err) or nil }
+			if not ok then
+				break
+			end
+		end
+		return results
+	end
+
+
+--
+-- Split a list of calls between forked worker processes. The solution calls
+-- are made here first, as the project calls may depend on what they leave
+-- behind, such as the Visual Studio configuration list. Then each worker
+-- takes every jobs'th project call, and writes what it printed, any error,
+-- and its trace events to a file for this process to collect; the share of
+-- a worker which can't be started is run here instead. If a solution call
+-- fails, only the project calls before it are made. The output is printed in the order
+-- of the calls, as if they had all been made here, up to the first error.
+-- The result files are always written with the real io.open, even if it
+-- has been replaced since, as the test suite does.
+--
+-- @returns
+--    False if there are too few project calls to be worth splitting.
+--
+
+	local builtin_open = io.open
+
+	local function callforked(calls, jobs)
+		local here, elsewhere = { }, { }
+		for i, c in ipairs(calls) do
+			table.insert(iif(c.here, here, elsewhere), i)
+		end
+
+		jobs = math.min(jobs, #elsewhere)
+		if jobs < 2 then
+			return false
+		end
+
+		local results = callshare(calls, here)
+
+		-- nothing after a failed solution call is made, as when run in order
+		local failed = #calls + 1
+		for i, r in pairs(results) do
+			if r.err then
+				failed = i
+			end
+		end
+		local projects = { }
+		for _, i in ipairs(elsewhere) do
+			if i < failed then
+				table.insert(projects, i)
+			end
+		end
+		jobs = math.min(jobs, #projects)
+
+		local workers = { }
+		for w = 1, jobs do
+			local share = { }
+			for i = w, #projects, jobs do
+				table.insert(share, projects[i])
+			end
+
+			local fname = os.tmpname()
+			local pid = os.fork()
+			if pid == 0 then
+				-- whatever happens, the worker must not return to the caller
+				local ok = pcall(function()
+					if premake.trace.isenabled() then
+						premake.trace.start()
+					end
+					local f = builtin_open(fname, "w")
+					for i, r in pairs(callshare(calls, share)) do
+						f:write(string.format("{ %d, %q, %q },\n", i, r.output, r.err or ""))
+					end
+					f:write("trace = { " .. premake.trace.serialize() .. " },\n")
+					f:close()
+				end)
+				os.exit(iif(ok, 0, 1))
+			end
+
+			table.insert(workers, { share = share, pid = pid, fname = fname })
+		end
+
+		for w, worker in ipairs(workers) do
+			local collected
+			if worker.pid then
+				local code, err = os.waitpid(worker.pid)
+				local f = builtin_open(worker.fname, "r")
+				local chunk = f and loadstring("return {" .. f:read("*a") .. "}")
+				if f then f:close() end
+				local written = (code == 0 and chunk) and chunk() or { }
+				collected = { }
+				for _, r in ipairs(written) do
+					collected[r[1]] = { output = r[2], err = (r[3] ~= "") and r[3] or nil }
+				end
+				premake.trace.append(written.trace or { }, w + 1)
+				-- a worker which died leaves its share unfinished
+				for _, i in ipairs(worker.share) do
+					if not collected[i] then
+						collected[i] = { output = "", err = "worker process failed: " .. (err or "exit code " .. tostring(code)) }
+					end
+					if collected[i].err then
+						break
+					end
+				end
+			else
+				collected = callshare(calls, worker.share)
+			end
+			os.remove(worker.fname)
+			for i, r in pairs(collected) do
+				results[i] = r
+			end
+		end
+
+		for i = 1, #calls do
+			local r = results[i]
+			if r then
+				if r.output ~= "" then
+					print(r.output)
+				end
+				if r.err then
+					error(r.err, 0)
+				end
+			end
+		end
+		return true
+	end
+
+
 --
 -- Trigger an action.
 --
 -- @param name
 --    The name of the action to be triggered.
+-- @param jobs
+--    Optional; the number of worker processes to split the projects between,
+--    once the configurations are built. Where processes can't be forked, as
+--    on Windows, the calls are all made in this one.
 -- @returns
 --    None.
 --
 
-	function premake.action.call(name)
+	function premake.action.call(name, jobs)
 		local a = premake.action.list[name]
 
+		if jobs and jobs > 1 then
+			local calls = { }
+			for _,sln in ipairs(_SOLUTIONS) do
+				if a.onsolution then
+					table.insert(calls, { a.onsolution, sln, here = true })
+				end
+				for prj in premake.eachproject(sln) do
+					if a.onproject then
+						table.insert(calls, { a.onproject, prj })
+					end
+				end
+			end
+			if callforked(calls, jobs) then
+				if a.execute then
+					a.execute()
+				end
+				return
+			end
+		end
+
 		for _,sln in ipairs(_SOLUTIONS) do
 			if a.onsolution then
 				a.onsolution(sln)
@@ -99,6 +333,8 @@
 --
 
 	function premake.action.each()
+		premake.action.loadall()
+		
 		-- sort the list by trigger
 		local keys = { }
 		for _, action in pairs(premake.action.list) do
@@ -123,6 +359,8 @@
 
 	function premake.action.set(name)
 		_ACTION = name
+		premake.action.load(name)
+		
 		-- Some actions imply a particular operating system
 		local action = premake.action.get(name)
 		if action then
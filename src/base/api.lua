@@ -93,6 +93,18 @@
 			}
 		},
 		
+		globignore =
+		{
+			kind  = "list",
+			scope = "solution",
+		},
+		
+		globignorefile =
+		{
+			kind  = "string",
+			scope = "solution",
+		},
+		
 		implibdir =
 		{
 			kind  = "path",
@@ -404,14 +416,51 @@
 
 	
 
+--
+-- Builds the list of patterns to be skipped while matching files, from the
+-- active solution's globignore list. Names without a slash are skipped at
+-- any depth; patterns with a slash are relative to the solution directory,
+-- and are passed both relative to the current directory and absolute, to
+-- match however the file masks were written. Returns the patterns and the
+-- name of the solution's ignore file, if it has one.
+--
+
+	local function getglobignore()
+		local sln = premake.getobject("solution")
+		if not sln then
+			return nil
+		end
+		
+		local excludes = { }
+		for _, pattern in ipairs(sln.globignore or { }) do
+			local trailing = iif(pattern:endswith("/"), "/", "")
+			local name = iif(trailing == "/", pattern:sub(1, -2), pattern)
+			if name:find("/", 1, true) then
+				if name:startswith("/") then
+					name = name:sub(2)
+				end
+				local abspath = path.join(sln.basedir, name)
+				table.insert(excludes, path.getrelative(os.getcwd(), abspath) .. trailing)
+				table.insert(excludes, abspath .. trailing)
+			else
+				table.insert(excludes, pattern)
+			end
+		end
+		
+		return excludes, sln.globignorefile
+	end
+	
+	
+
 --
 -- Adds values to an array-of-directories field of a solution/project/configuration. 
 -- `ctype` specifies the container type (see premake.getobject) for the field. All
 -- values are converted to absolute paths before being stored.
 --
 
-	local function domatchedarray(ctype, fieldname, value, matchfunc)
+	local function domatchedarray(ctype, fieldname, value, wantfiles)
 		local result = { }
+		local masks = { }
 		
 		function makeabsolute(value)
 			if (type(value) == "table") then
@@ -420,7 +469,10 @@
 				end
 			else
 				if value:find("*") then
-					makeabsolute(matchfunc(value))
+					-- collect the masks, so the tree only gets walked once; the
+					-- mask number holds its place in the list
+					table.insert(masks, value)
+					table.insert(result, #masks)
 				else
 					table.insert(result, path.getabsolute(value))
 				end
@@ -428,15 +480,45 @@
 		end
 		
 		makeabsolute(value)
+		
+		-- each mask's matches take the place of that mask in the list
+		if #masks > 0 then
+			local matches, numbers = { }, { }
+			premake.trace.begin(iif(wantfiles, "os.matchfiles", "os.matchdirs"), "match", { pattern = table.concat(masks, " ") })
+			local excludes, ignorefile = getglobignore()
+			os.matchwalk(matches, masks, wantfiles, excludes, ignorefile, numbers)
+			premake.trace.finish({ count = #matches })
+			
+			local bymask = { }
+			for i = 1, #masks do
+				bymask[i] = { }
+			end
+			for i, fname in ipairs(matches) do
+				table.insert(bymask[numbers[i]], path.getabsolute(fname))
+			end
+			
+			local placed = { }
+			for _, item in ipairs(result) do
+				if type(item) == "number" then
+					for _, fname in ipairs(bymask[item]) do
+						table.insert(placed, fname)
+					end
+				else
+					table.insert(placed, item)
+				end
+			end
+			result = placed
+		end
+		
 		return premake.setarray(ctype, fieldname, result)
 	end
 	
 	function premake.setdirarray(ctype, fieldname, value)
-		return domatchedarray(ctype, fieldname, value, os.matchdirs)
+		return domatchedarray(ctype, fieldname, value, false)
 	end
 	
 	function premake.setfilearray(ctype, fieldname, value)
-		return domatchedarray(ctype, fieldname, value, os.matchfiles)
+		return domatchedarray(ctype, fieldname, value, true)
 	end
 	
 	
@@ -535,18 +617,15 @@
 			table.insert(cfg.keywords, premake.escapekeyword(word))
 		end
 		
-		-- if file patterns are specified, convert them to Lua patterns and add them too
+		-- if file patterns are specified, add them too
 		if keywords.files then
 			for _, pattern in ipairs(table.join({}, keywords.files)) do
-				pattern = pattern:gsub("%.", "%%.")
-				if pattern:find("**", nil, true) then
-					pattern = pattern:gsub("%*%*", ".*")
-				else
-					pattern = pattern:gsub("%*", "[^/]*")
-				end
-				table.insert(cfg.keywords, "^" .. pattern .. "$")
+				table.insert(cfg.keywords, premake.escapekeyword(pattern))
 			end
-		end		
+		end
+		
+		-- compile the keywords once, rather than every time they are tested
+		cfg.matchers = premake.compilekeywords(cfg.keywords)
 
 		-- initialize list-type fields to empty tables
 		for name, field in pairs(premake.fields) do
@@ -593,7 +672,7 @@
 			prj.solution       = sln
 			prj.name           = name
 			prj.basedir        = os.getcwd()
-			prj.uuid           = os.uuid()
+			prj.uuid           = os.uuid(sln.name .. "/" .. name)
 			prj.blocks         = { }
 		end
 
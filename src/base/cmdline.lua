@@ -9,6 +9,12 @@
 -- Built-in command line options
 --
 
+	newoption
+	{
+		trigger     = "allocstats",
+		description = "Report the script memory allocations when done"
+	}
+
 	newoption 
 	{
 		trigger     = "cc",
@@ -32,6 +38,12 @@
 		}
 	}
 
+	newoption
+	{
+		trigger     = "fast-exit",
+		description = "Exit without freeing script memory; faster for one-shot runs"
+	}
+	
 	newoption
 	{
 		trigger     = "file",
@@ -39,12 +51,44 @@
 		description = "Read FILE as a Premake script; default is 'premake4.lua'"
 	}
 	
+	newoption
+	{
+		trigger     = "glob-threads",
+		value       = "N",
+		description = "Use N threads to search directories for files, up to 64; default is one per CPU, up to 16"
+	}
+	
 	newoption
 	{
 		trigger     = "help",
 		description = "Display this information"
 	}
 		
+	newoption
+	{
+		trigger     = "jobs",
+		value       = "N",
+		description = "Generate the project files in N processes (not on Windows)"
+	}
+	
+	newoption
+	{
+		trigger     = "memstats",
+		description = "Report the memory used by each phase and the largest projects"
+	}
+	
+	newoption
+	{
+		trigger     = "no-glob-cache",
+		description = "Don't cache directory listings in .premake/globcache"
+	}
+	
+	newoption
+	{
+		trigger     = "no-script-cache",
+		description = "Don't keep compiled scripts in .premake/cache"
+	}
+	
 	newoption
 	{
 		trigger     = "os",
@@ -74,6 +118,13 @@
 		}
 	}
 	
+	newoption
+	{
+		trigger     = "profile",
+		value       = "FILE",
+		description = "Sample the scripts and write their call stacks to FILE"
+	}
+	
 	newoption
 	{
 		trigger     = "scripts",
@@ -81,6 +132,19 @@
 		description = "Search for additional scripts on the given path"
 	}
 	
+	newoption
+	{
+		trigger     = "trace",
+		value       = "FILE",
+		description = "Write a trace of the run to FILE, for chrome://tracing"
+	}
+	
+	newoption
+	{
+		trigger     = "verify-stable",
+		description = "Generate twice and report any files which come out differently"
+	}
+	
 	newoption
 	{
 		trigger     = "version",
@@ -14,6 +14,7 @@
 	{
 		blocks    = true,
 		keywords  = true,
+		matchers  = true,
 		projects  = true,
 		__configs = true,
 	}
@@ -67,40 +68,179 @@
 	
 	
 --
--- Test a single configuration block keyword against a list of terms.
--- The terms are a mix of key/value pairs. The keyword is tested against
--- the values; on a match, the corresponding key is returned. This 
--- enables testing for required values in iskeywordsmatch(), below.
+-- Compile a keyword, as escaped by escapekeyword(), into a matcher object.
+-- Any "not" is pulled off and the " or " alternatives are split apart once,
+-- up front. Alternatives without any pattern characters are kept as literal
+-- words, to be looked up in an index of the terms. Those which are only a
+-- literal prefix or suffix and a ".*", like "src/.*" or ".*%.cpp", are kept
+-- as plain strings to compare against the start or end of a term. The rest
+-- are anchored to match whole terms. The same keywords turn up in block
+-- after block, so matchers are cached by keyword.
 --
 
-	function premake.iskeywordmatch(keyword, terms)
-		-- is it negated?
-		if keyword:startswith("not ") then
-			return not premake.iskeywordmatch(keyword:sub(5), terms)
+	local matchers = { }
+
+	local function isliteral(word)
+		return not word:gsub("%%%p", ""):find("[%^%$%*%+%-%?%.%[%]%(%)%%]")
+	end
+	
+	local function unescape(word)
+		return (word:gsub("%%(%p)", "%1"))
+	end
+
+	function premake.compilekeyword(keyword)
+		local matcher = matchers[keyword]
+		if matcher then
+			return matcher
 		end
 		
-		for _, word in ipairs(keyword:explode(" or ")) do
-			local pattern = "^" .. word .. "$"
-			for termkey, term in pairs(terms) do
-				if term:match(pattern) then
-					return termkey
-				end
+		matcher = { negated = false, literals = { }, prefixes = { }, suffixes = { }, patterns = { } }
+		local word = keyword
+		while word:startswith("not ") do
+			matcher.negated = not matcher.negated
+			word = word:sub(5)
+		end
+		
+		for _, alt in ipairs(word:explode(" or ")) do
+			if isliteral(alt) then
+				table.insert(matcher.literals, unescape(alt))
+			elseif alt:sub(-2) == ".*" and isliteral(alt:sub(1, -3)) then
+				table.insert(matcher.prefixes, unescape(alt:sub(1, -3)))
+			elseif alt:startswith(".*") and isliteral(alt:sub(3)) then
+				table.insert(matcher.suffixes, unescape(alt:sub(3)))
+			else
+				table.insert(matcher.patterns, "^" .. alt .. "$")
 			end
 		end
+		
+		matchers[keyword] = matcher
+		return matcher
 	end
+
+
+--
+-- Compile a list of keywords into a list of matchers; see compilekeyword().
+--
+
+	function premake.compilekeywords(keywords)
+		local result = { }
+		for i, keyword in ipairs(keywords) do
+			result[i] = premake.compilekeyword(keyword)
+		end
+		return result
+	end
+	
 	
+
+--
+-- Index a list of terms by value, for the literal keyword lookups; each
+-- value maps to the key of the first term holding it. The required term
+-- changes from file to file, so it is left out and checked on its own.
+-- The indexes are cached by terms table, which must not otherwise change
+-- once it has been matched against.
+--
+
+	local termindexes = setmetatable({ }, { __mode = "k" })
+
+	local function getindex(terms)
+		local index = termindexes[terms]
+		if not index then
+			index = { keys = { }, list = { } }
+			local function add(key, term)
+				if not index.keys[term] then
+					index.keys[term] = key
+					table.insert(index.list, { key = key, term = term })
+				end
+			end
+			for key, term in ipairs(terms) do
+				add(key, term)
+			end
+			for key, term in pairs(terms) do
+				if type(key) ~= "number" and key ~= "required" then
+					add(key, term)
+				end
+			end
+			termindexes[terms] = index
+		end
+		return index
+	end
+
+
+
+--
+-- Test a compiled keyword against a list of terms. The terms are a mix
+-- of key/value pairs. The keyword is tested against the values; on a match,
+-- the corresponding key is returned. This enables testing for required
+-- values in matchkeywords(), below.
+--
+
+	local function matchshape(matcher, term)
+		for _, prefix in ipairs(matcher.prefixes) do
+			if term:sub(1, #prefix) == prefix then
+				return true
+			end
+		end
+		for _, suffix in ipairs(matcher.suffixes) do
+			if #suffix == 0 or term:sub(-#suffix) == suffix then
+				return true
+			end
+		end
+		for _, pattern in ipairs(matcher.patterns) do
+			if term:match(pattern) then
+				return true
+			end
+		end
+		return false
+	end
+
+	local function matchterm(matcher, term)
+		for _, literal in ipairs(matcher.literals) do
+			if term == literal then
+				return true
+			end
+		end
+		return matchshape(matcher, term)
+	end
 	
+	function premake.matchkeyword(matcher, terms)
+		local index = getindex(terms)
+		local result
+		
+		for _, literal in ipairs(matcher.literals) do
+			result = index.keys[literal]
+			if result then break end
+		end
+		
+		if not result and (#matcher.prefixes > 0 or #matcher.suffixes > 0 or #matcher.patterns > 0) then
+			for _, t in ipairs(index.list) do
+				if matchshape(matcher, t.term) then
+					result = t.key
+					break
+				end
+			end
+		end
+		
+		if not result and terms.required and matchterm(matcher, terms.required) then
+			result = "required"
+		end
 		
+		if matcher.negated then
+			return not result
+		end
+		return result
+	end
+
+
 --
--- Checks a set of configuration block keywords against a list of terms.
--- I've already forgotten the purpose of the required terms (d'oh!) but
--- I'll see if I can figure it out on a future refactoring.
+-- Checks a list of compiled keywords against a list of terms. All of the
+-- keywords must match. If there is a required term, such as the file name
+-- when building the per-file configurations, one of them must match it too.
 --
 
-	function premake.iskeywordsmatch(keywords, terms)
+	function premake.matchkeywords(matchers, terms)
 		local hasrequired = false
-		for _, keyword in ipairs(keywords) do
-			local matched = premake.iskeywordmatch(keyword, terms)
+		for _, matcher in ipairs(matchers) do
+			local matched = premake.matchkeyword(matcher, terms)
 			if not matched then
 				return false
 			end
@@ -115,10 +255,27 @@
 			return true
 		end
 	end
+	
 
 
 --
--- Converts path fields from absolute to location-relative paths.
+-- Test a single keyword, or a list of keywords, against a list of terms.
+-- These compile the keywords as needed; the configuration blocks keep
+-- their keywords compiled, and use matchkeywords() instead.
+--
+
+	function premake.iskeywordmatch(keyword, terms)
+		return premake.matchkeyword(premake.compilekeyword(keyword), terms)
+	end
+
+	function premake.iskeywordsmatch(keywords, terms)
+		return premake.matchkeywords(premake.compilekeywords(keywords), terms)
+	end
+
+
+--
+-- Converts path fields from absolute to location-relative paths. Lists are
+-- replaced rather than changed in place, as they may be shared; see below.
 --
 -- @param location
 --    The base location, paths will be relative to this directory.
@@ -133,9 +290,7 @@
 				if field.kind == "path" then
 					obj[name] = path.getrelative(location, value) 
 				elseif field.kind == "dirlist" or field.kind == "filelist" then
-					for i, p in ipairs(value) do 
-						value[i] = path.getrelative(location, p) 
-					end
+					obj[name] = table.translate(value, function(p) return path.getrelative(location, p) end)
 				end
 			end
 		end
@@ -147,6 +302,12 @@
 -- Merge all of the fields from one object into another. String values are overwritten,
 -- while list values are merged. Fields listed in premake.nocopy are skipped.
 --
+-- A list field is only copied when both sides have values to be joined; if
+-- either side is empty, the destination shares the other one's list. Most
+-- lists are only set at one level, so the solution, project, and matching
+-- blocks no longer get copied into every configuration. This does mean the
+-- configuration lists must be treated as read-only once built.
+--
 -- @param dest
 --    The destination object, to contain the merged settings.
 -- @param src
@@ -157,8 +318,15 @@
 		if not src then return end
 		for field, value in pairs(src) do
 			if not nocopy[field] then
-				if type(value) == "table" then
-					dest[field] = table.join(dest[field] or {}, value)
+				local current = dest[field]
+				if type(value) == "table" and premake.fields[field] then
+					if not current or #current == 0 then
+						dest[field] = value
+					elseif #value > 0 then
+						dest[field] = table.join(current, value)
+					end
+				elseif type(value) == "table" then
+					dest[field] = table.join(current or {}, value)
 				else
 					dest[field] = value
 				end
@@ -203,7 +371,7 @@
 		terms.platform = pltname:lower()
 		
 		for _, blk in ipairs(obj.blocks) do
-			if (premake.iskeywordsmatch(blk.keywords, terms)) then
+			if (premake.matchkeywords(blk.matchers, terms)) then
 				mergeobject(cfg, blk)
 			end
 		end
@@ -251,6 +419,274 @@
 	end
 	
 
+--
+-- Finds the project blocks which might apply to single files in a configuration.
+-- A block only applies to a file if one of its keywords matches the file name
+-- and none of the configuration's terms, and if all of the others match as well.
+-- So the keywords can be split once, up front: those which don't match the
+-- configuration must all match the file, and any negated ones which do
+-- match the configuration must not match the file. Blocks with a negated
+-- keyword which doesn't match the configuration can never apply.
+--
+-- @param cfg
+--    The configuration to be searched.
+-- @returns
+--    A list of the blocks which might apply, in order, each with its index
+--    in the project block list and the two lists of keywords to be tested.
+--
+
+	local function getfileblocks(cfg)
+		local result = { }
+		for i, blk in ipairs(cfg.project.blocks) do
+			local entry = { index = i, block = blk, matchers = { }, negated = { } }
+			for _, matcher in ipairs(blk.matchers) do
+				if premake.matchkeyword(matcher, cfg.terms) then
+					if matcher.negated then
+						table.insert(entry.negated, matcher)
+					end
+				elseif matcher.negated then
+					entry = nil
+					break
+				else
+					table.insert(entry.matchers, matcher)
+				end
+			end
+			if entry and #entry.matchers > 0 then
+				table.insert(result, entry)
+			end
+		end
+		return result
+	end
+
+
+
+--
+-- Indexes the file blocks by the first keyword each has left to match, so a
+-- file is only tested against the blocks which might apply to it. Literal
+-- names are keyed by name. Prefixes and suffixes are keyed by length, and
+-- then by value, so a file looks up its own prefix or suffix of each length.
+-- Only the blocks which need a full pattern match are tried on every file.
+--
+
+	local function indexfileblocks(entries)
+		local index = { names = { }, prefixes = { }, suffixes = { }, scan = { } }
+		
+		local function add(map, key, pos)
+			map[key] = map[key] or { }
+			table.insert(map[key], pos)
+		end
+		
+		for pos, entry in ipairs(entries) do
+			local matcher = entry.matchers[1]
+			if #matcher.patterns > 0 then
+				table.insert(index.scan, pos)
+			else
+				for _, literal in ipairs(matcher.literals) do
+					add(index.names, literal, pos)
+				end
+				for _, prefix in ipairs(matcher.prefixes) do
+					index.prefixes[#prefix] = index.prefixes[#prefix] or { }
+					add(index.prefixes[#prefix], prefix, pos)
+				end
+				for _, suffix in ipairs(matcher.suffixes) do
+					index.suffixes[#suffix] = index.suffixes[#suffix] or { }
+					add(index.suffixes[#suffix], suffix, pos)
+				end
+			end
+		end
+		return index
+	end
+	
+	
+--
+-- Returns the positions of the file blocks which might apply to a file, in
+-- order, using an index built by indexfileblocks().
+--
+
+	local function getcandidates(index, term)
+		local found = { }
+		local function collect(list)
+			for _, pos in ipairs(list or { }) do
+				found[pos] = true
+			end
+		end
+		
+		collect(index.names[term])
+		for len, map in pairs(index.prefixes) do
+			collect(map[term:sub(1, len)])
+		end
+		for len, map in pairs(index.suffixes) do
+			collect(map[iif(len == 0, "", term:sub(-len))])
+		end
+		collect(index.scan)
+		
+		local result = { }
+		for pos in pairs(found) do
+			table.insert(result, pos)
+		end
+		table.sort(result)
+		return result
+	end
+
+
+
+--
+-- Creates the list of file configurations for a configuration, indexed by
+-- file name and by position in the file list. Nothing is built until it is
+-- asked for, as most actions only want the files of the root configuration,
+-- if any. The settings from the matching blocks are merged just once for
+-- each distinct set of blocks, and shared through a metatable by all of the
+-- files with that set; most files have no file-specific blocks, and share a
+-- single empty set.
+--
+
+	local function newfileconfigs(cfg)
+		local fileblocks, index, members
+		local shared = { }
+		
+		local function build(fname)
+			if not fileblocks then
+				fileblocks = getfileblocks(cfg)
+				index = indexfileblocks(fileblocks)
+			end
+			
+			local term = fname:lower()
+			local blocks, indices = { }, { }
+			for _, pos in ipairs(getcandidates(index, term)) do
+				local entry = fileblocks[pos]
+				local matched = true
+				for _, matcher in ipairs(entry.matchers) do
+					matched = matchterm(matcher, term)
+					if not matched then break end
+				end
+				for _, matcher in ipairs(entry.negated) do
+					if not matched then break end
+					matched = not matchterm(matcher, term)
+				end
+				if matched then
+					table.insert(blocks, entry.block)
+					table.insert(indices, entry.index)
+				end
+			end
+			
+			local key = table.concat(indices, " ")
+			if not shared[key] then
+				local settings = { }
+				for _, blk in ipairs(blocks) do
+					mergeobject(settings, blk)
+				end
+				shared[key] = { __index = settings }
+			end
+			return setmetatable({ name = fname }, shared[key])
+		end
+		
+		return setmetatable({ }, { __index = function(list, key)
+			local fname = key
+			if type(key) == "number" then
+				fname = cfg.files[key]
+			else
+				if not members then
+					members = { }
+					for _, f in ipairs(cfg.files) do
+						members[f] = true
+					end
+				end
+				if not members[key] then
+					fname = nil
+				end
+			end
+			if not fname then
+				return nil
+			end
+			
+			local fcfg = rawget(list, fname) or build(fname)
+			rawset(list, fname, fcfg)
+			rawset(list, key, fcfg)
+			return fcfg
+		end })
+	end
+	
+
+
+--
+-- Builds the file lists for all of a project's configurations. The files of
+-- every configuration are gathered into one list, keeping the order each
+-- configuration lists them in, with any duplicates dropped. Each configuration then gets
+-- that list less the files it doesn't have or excludes. The positions left
+-- out act as a key, so configurations with the same files share a list,
+-- and in the usual case they all share the project-wide list.
+--
+-- @param prj
+--    The project, with its configurations collapsed.
+--
+
+	local function buildfilelists(prj)
+		local keys = table.keys(prj.__configs)
+		table.sort(keys)
+		
+		-- a file first seen in one configuration goes in just after the file
+		-- listed before it there, so that every configuration's files keep
+		-- the order they were listed in, whichever blocks they came from
+		local after, known, head = { }, { }, { }
+		for _, key in ipairs(keys) do
+			local prev = head
+			for _, fname in ipairs(prj.__configs[key].files) do
+				if not known[fname] then
+					known[fname] = true
+					after[fname] = after[prev]
+					after[prev] = fname
+				end
+				prev = fname
+			end
+		end
+		
+		local all, position = { }, { }
+		local fname = after[head]
+		while fname do
+			table.insert(all, fname)
+			position[fname] = #all
+			fname = after[fname]
+		end
+		
+		local lists = { }
+		for _, key in ipairs(keys) do
+			local cfg = prj.__configs[key]
+			local present = { }
+			for _, fname in ipairs(cfg.files) do
+				present[position[fname]] = true
+			end
+			for _, fname in ipairs(cfg.excludes) do
+				if position[fname] then
+					present[position[fname]] = nil
+				end
+			end
+			
+			local missing = { }
+			for i = 1, #all do
+				if not present[i] then
+					table.insert(missing, i)
+				end
+			end
+			
+			local id = table.concat(missing, " ")
+			if not lists[id] then
+				if #missing == 0 then
+					lists[id] = all
+				else
+					lists[id] = { }
+					for i, fname in ipairs(all) do
+						if present[i] then
+							table.insert(lists[id], fname)
+						end
+					end
+				end
+			end
+			cfg.files = lists[id]
+		end
+	end
+
+
+
 --
 -- Post-process a project configuration, applying path fix-ups and other adjustments
 -- to the "raw" setting data pulled from the project script.
@@ -282,46 +718,18 @@
 			cfg.kind = "StaticLib"
 		end
 		
-		-- remove excluded files from the file list
-		local files = { }
-		for _, fname in ipairs(cfg.files) do
-			local excluded = false
-			for _, exclude in ipairs(cfg.excludes) do
-				excluded = (fname == exclude)
-				if (excluded) then break end
-			end
-						
-			if (not excluded) then
-				table.insert(files, fname)
-			end
-		end
-		cfg.files = files
-
 		-- fixup the data		
 		for name, field in pairs(premake.fields) do
-			-- re-key flag fields for faster lookups
+			-- re-key flag fields for faster lookups; the list may be shared, but
+			-- it is only given keys matching its own values, so that's harmless
 			if field.isflags then
 				local values = cfg[name]
 				for _, flag in ipairs(values) do values[flag] = true end
 			end
 		end
 		
-		-- build configuration objects for all files
-		cfg.__fileconfigs = { }
-		for _, fname in ipairs(cfg.files) do
-			cfg.terms.required = fname:lower()
-			local fcfg = {}
-			for _, blk in ipairs(cfg.project.blocks) do
-				if (premake.iskeywordsmatch(blk.keywords, cfg.terms)) then
-					mergeobject(fcfg, blk)
-				end
-			end
-
-			-- add indexed by name and integer
-			fcfg.name = fname
-			cfg.__fileconfigs[fname] = fcfg
-			table.insert(cfg.__fileconfigs, fcfg)
-		end
+		-- the file configurations are built as they are asked for
+		cfg.__fileconfigs = newfileconfigs(cfg)
 	end
 
 
@@ -439,10 +847,13 @@
 		for _, sln in ipairs(_SOLUTIONS) do
 			local basis = collapse(sln)
 			for _, prj in ipairs(sln.projects) do
+				premake.trace.begin(prj.name, "collapse")
 				prj.__configs = collapse(prj, basis)
+				buildfilelists(prj)
 				for _, cfg in pairs(prj.__configs) do
 					postprocess(prj, cfg)
 				end
+				premake.trace.finish()
 			end
 		end	
 		
@@ -67,10 +67,10 @@
 --
 -- A replacement for Lua's built-in dofile() function, this one sets the
 -- current working directory to the script's location, enabling script-relative
--- referencing of other files and resources.
+-- referencing of other files and resources. If premake.scriptcache names a
+-- directory, the compiled scripts are kept there and reused until they change.
 --
 
-	local builtin_dofile = dofile
 	function dofile(fname)
 		-- remember the current working directory; I'll restore it shortly
 		local oldcwd = os.getcwd()
@@ -91,8 +91,30 @@
 		local newcwd = path.getdirectory(fname)
 		os.chdir(newcwd)
 		
-		-- run the chunk
-		local ret = {builtin_dofile(fname)}
+		-- compile and run the chunk; the tracer itself is loaded by this
+		-- function, so it may not be there yet. While tracing, an error is
+		-- caught just long enough to close the span, and then raised again.
+		local trace = premake.trace
+		local tracing = trace and trace.isenabled()
+		if tracing then trace.begin(fname, "dofile") end
+		local chunk, err = os.loadscript(fname, premake.scriptcache)
+		if (not chunk) then
+			if tracing then trace.finish() end
+			os.chdir(oldcwd)
+			error(err, 0)
+		end
+		local ret
+		if tracing then
+			ret = {pcall(chunk)}
+			trace.finish()
+			if (not ret[1]) then
+				os.chdir(oldcwd)
+				error(ret[2], 0)
+			end
+			table.remove(ret, 1)
+		else
+			ret = {chunk()}
+		end
 		
 		-- restore the previous working directory when done
 		os.chdir(oldcwd)
@@ -29,7 +29,9 @@
 	
 --
 -- Open an overload of the io.open() function, which will create any missing
--- subdirectories in the filename if "mode" is set to writeable.
+-- subdirectories in the filename if "mode" is set to writeable. A file opened
+-- for writing may not have existed before, so the host is told to forget
+-- anything it remembers about it.
 --
 
 	local builtin_open = io.open
@@ -42,6 +44,9 @@
 					error(err, 0)
 				end
 			end
+			if (mode:find("[wa+]")) then
+				os.flushcache(fname)
+			end
 		end
 		return builtin_open(fname, mode)
 	end
@@ -0,0 +1,249 @@
+--
+-- memstats.lua
+-- Reports where the memory goes, by phase and by project; see --memstats.
+-- Copyright (c) 2002-2009 Jason Perkins and the Premake project
+--
+
+	premake.memstats = { }
+
+
+-- The samples taken since premake.memstats.start(); nil when not sampling.
+
+	local samples
+
+
+
+--
+-- Starts a new set of samples.
+--
+
+	function premake.memstats.start()
+		samples = { }
+	end
+
+
+--
+-- Stops sampling and discards the samples.
+--
+
+	function premake.memstats.stop()
+		samples = nil
+	end
+
+
+
+--
+-- Records the memory in use at the end of a phase. A full collection is
+-- run first, so the Lua figure is what the phase left behind; the peak
+-- comes from the allocator, and is the most in use at any point since the
+-- previous sample, garbage included.
+--
+-- @param phase
+--    The name of the phase which just finished.
+--
+
+	function premake.memstats.sample(phase)
+		if samples then
+			collectgarbage("collect")
+			local stats = os.allocstats(true)
+			table.insert(samples, {
+				phase  = phase,
+				live   = collectgarbage("count") * 1024,
+				peak   = stats.peaksince,
+				allocs = stats.allocs,
+			})
+		end
+	end
+
+
+
+--
+-- Estimates the memory used by a value and everything it refers to, using
+-- the sizes of Lua 5.1's structures on a 64-bit system. Each table and
+-- string is only counted once per set of seen values.
+--
+-- @param value
+--    The value to measure.
+-- @param seen
+--    A table of the values which have already been counted; any solution
+--    or project objects should be in here, so a walk stops at them.
+-- @returns
+--    The estimated size in bytes.
+--
+
+	local function hashsize(n)
+		local size = 1
+		while size < n do
+			size = size * 2
+		end
+		return size
+	end
+
+	function premake.memstats.estimate(value, seen)
+		if seen[value] then
+			return 0
+		end
+
+		local kind = type(value)
+		if kind == "string" then
+			seen[value] = true
+			return 25 + #value
+		elseif kind ~= "table" then
+			return 0
+		end
+
+		seen[value] = true
+		local narray, nhash, size = #value, 0, 0
+		for k, v in pairs(value) do
+			if type(k) ~= "number" or k < 1 or k > narray or k % 1 ~= 0 then
+				nhash = nhash + 1
+			end
+			size = size + premake.memstats.estimate(k, seen) + premake.memstats.estimate(v, seen)
+		end
+
+		size = size + 56 + narray * 16
+		if nhash > 0 then
+			size = size + hashsize(nhash) * 40
+		end
+		return size
+	end
+
+
+
+--
+-- Finds the values which more than one project refers to: the solutions and
+-- projects themselves, and any lists, tables, or strings they share.
+--
+-- @returns
+--    A set of the shared values.
+--
+
+	local function findowners(value, owner, owners)
+		local kind = type(value)
+		if (kind ~= "table" and kind ~= "string") or owners[value] == owner or owners[value] == false then
+			return
+		end
+
+		-- a value reached from a second project is shared, as is everything
+		-- it refers to
+		if owners[value] == nil then
+			owners[value] = owner
+		else
+			owners[value] = false
+		end
+
+		if kind == "table" then
+			for k, v in pairs(value) do
+				findowners(k, owner, owners)
+				findowners(v, owner, owners)
+			end
+		end
+	end
+
+	function premake.memstats.shared()
+		local owners = { }
+		for _, sln in ipairs(_SOLUTIONS) do
+			owners[sln] = false
+			for _, prj in ipairs(sln.projects) do
+				owners[prj] = false
+			end
+		end
+
+		for _, sln in ipairs(_SOLUTIONS) do
+			for _, prj in ipairs(sln.projects) do
+				for k, v in pairs(prj) do
+					findowners(k, prj, owners)
+					findowners(v, prj, owners)
+				end
+			end
+		end
+
+		local shared = { }
+		for value, owner in pairs(owners) do
+			if owner == false then
+				shared[value] = true
+			end
+		end
+		return shared
+	end
+
+
+
+--
+-- Estimates the memory held by one project, split into its configuration
+-- blocks, the per-file configurations, the rest of the built configurations,
+-- and everything else. Anything another project refers to as well, such as
+-- the solution or a shared list, is left out.
+--
+-- @param prj
+--    The project to measure.
+-- @param shared
+--    Optional; the shared values, from premake.memstats.shared(). Pass it in
+--    when measuring several projects, to save finding them each time.
+--
+
+	function premake.memstats.project(prj, shared)
+		local seen = setmetatable({ }, { __index = shared or premake.memstats.shared() })
+
+		local estimate = premake.memstats.estimate
+		local result = { name = prj.name }
+		result.blocks = estimate(prj.blocks, seen)
+
+		result.fileconfigs = 0
+		for _, cfg in pairs(prj.__configs or { }) do
+			result.fileconfigs = result.fileconfigs + estimate(cfg.__fileconfigs or { }, seen)
+		end
+		result.configs = estimate(prj.__configs or { }, seen)
+
+		result.other = 0
+		for k, v in pairs(prj) do
+			result.other = result.other + estimate(k, seen) + estimate(v, seen)
+		end
+
+		result.total = result.blocks + result.fileconfigs + result.configs + result.other
+		return result
+	end
+
+
+
+--
+-- Prints the phase samples, and the projects which hold the most memory.
+--
+-- @param count
+--    The number of projects to list; defaults to ten.
+--
+
+	local function kb(bytes)
+		return string.format("%10.0f", bytes / 1024)
+	end
+
+	function premake.memstats.report(count)
+		count = count or 10
+
+		print("Memory by phase (KB):")
+		printf("  %-24s%10s%10s%12s", "phase", "live", "peak", "allocs")
+		for _, s in ipairs(samples or { }) do
+			printf("  %-24s%s%s%12d", s.phase, kb(s.live), kb(s.peak), s.allocs)
+		end
+
+		local projects = { }
+		local shared = premake.memstats.shared()
+		for _, sln in ipairs(_SOLUTIONS) do
+			for _, prj in ipairs(sln.projects) do
+				table.insert(projects, premake.memstats.project(prj, shared))
+			end
+		end
+		table.sort(projects, function(a, b)
+			if a.total ~= b.total then
+				return a.total > b.total
+			end
+			return a.name < b.name
+		end)
+
+		printf("Largest projects, estimated (KB), %d of %d:", math.min(count, #projects), #projects)
+		printf("  %-24s%10s%10s%10s%12s%10s", "project", "total", "blocks", "configs", "fileconfigs", "other")
+		for i = 1, math.min(count, #projects) do
+			local p = projects[i]
+			printf("  %-24s%s%s%s  %s%s", p.name, kb(p.total), kb(p.blocks), kb(p.configs), kb(p.fileconfigs), kb(p.other))
+		end
+	end
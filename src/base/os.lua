@@ -67,49 +67,45 @@
 	
 
 --
--- The os.matchdirs() and os.matchfiles() functions
+-- The os.matchdirs() and os.matchfiles() functions. The directory walking,
+-- including the recursion for "**" masks, is done by os.matchwalk() in the
+-- host. All of the masks are matched in a single pass, so each directory is
+-- only read once; brace alternatives like "**.{c,cpp,h}" are expanded. The
+-- results come back in the order of the masks, and a name matched by more
+-- than one mask is listed for each. Each mask's matches are sorted by name
+-- within a directory, with subdirectories following their parent, so they
+-- do not depend on the file system order.
 --
 
-	local function domatch(result, mask, wantfiles)
-		local basedir = path.getdirectory(mask)
-		if (basedir == ".") then basedir = "" end
+	local function matchmasks(masks, wantfiles)
+		local matches, numbers = { }, { }
+		os.matchwalk(matches, masks, wantfiles, nil, nil, numbers)
 		
-		local m = os.matchstart(mask)
-		while (os.matchnext(m)) do
-			local fname = os.matchname(m)
-			local isfile = os.matchisfile(m)
-			if ((wantfiles and isfile) or (not wantfiles and not isfile)) then
-				table.insert(result, path.join(basedir, fname))
-			end
+		local bymask = { }
+		for i = 1, #masks do
+			bymask[i] = { }
 		end
-		os.matchdone(m)
-
-		-- if the mask uses "**", recurse subdirectories
-		if (mask:find("**", nil, true)) then
-			mask = path.getname(mask)			
-			m = os.matchstart(path.join(basedir, "*"))
-			while (os.matchnext(m)) do
-				local dirname = os.matchname(m)
-				local submask = path.join(path.join(basedir, dirname), mask)
-				domatch(result, submask, wantfiles)
-			end
-			os.matchdone(m)
+		for i, name in ipairs(matches) do
+			table.insert(bymask[numbers[i]], name)
 		end
-	end
-	
-	function os.matchdirs(...)
+		
 		local result = { }
-		for _, mask in ipairs(arg) do
-			domatch(result, mask, false)
+		for _, names in ipairs(bymask) do
+			for _, name in ipairs(names) do
+				table.insert(result, name)
+			end
 		end
 		return result
 	end
+
+	function os.matchdirs(...)
+		return matchmasks(arg, false)
+	end
 	
 	function os.matchfiles(...)
-		local result = { }
-		for _, mask in ipairs(arg) do
-			domatch(result, mask, true)
-		end
+		premake.trace.begin("os.matchfiles", "match", { pattern = table.concat(arg, " ") })
+		local result = matchmasks(arg, true)
+		premake.trace.finish({ count = #result })
 		return result
 	end
 	
@@ -140,6 +136,21 @@
 	end
 
 
+--
+-- An overload of the os.execute() function. The command may have changed
+-- anything on the file system, so the host's cached file information is
+-- thrown away once it finishes.
+--
+
+	local builtin_execute = os.execute
+	function os.execute(cmd)
+		local result = builtin_execute(cmd)
+		os.flushcache()
+		return result
+	end
+	
+	
+	
 --
 -- Remove a directory, along with any contained files or subdirectories.
 --
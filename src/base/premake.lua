@@ -21,8 +21,9 @@
 
 	function premake.generate(obj, filename, callback)
 		filename = premake.project.getfilename(obj, filename)
-    tmpfilename = filename .. ".tmp"
+		local tmpfilename = filename .. ".tmp"
 		printf("Generating %s...", filename)
+		premake.trace.begin(filename, "generate")
 
 		local f, err = io.open(tmpfilename, "wb")
 		if (not f) then
@@ -31,27 +32,79 @@
 
 		io.output(f)
 		callback(obj)
+		if premake.trace.isenabled() then
+			premake.trace.finish({ bytes = f:seek("end") })
+		end
 		f:close()
-    if os.isfile(filename) then
-      local function slurp(name)
-        local f = io.open(name, "rb")
-        local ret = f:read("*a")
-        f:close()
-        return ret
-      end
-      local old = slurp(filename)
-      local new = slurp(tmpfilename)
-      if old ~= new then
-        os.remove(filename)
-        os.rename(tmpfilename, filename)
-      else
-        os.remove(tmpfilename)
-      end
-    else
-      os.rename(tmpfilename, filename)
-    end
+
+		local function slurp(name)
+			local f = io.open(name, "rb")
+			local ret = f:read("*a")
+			f:close()
+			return ret
+		end
+
+		-- keep a copy of the output if premake.verifystable() is watching
+		local exists = os.isfile(filename)
+		local new
+		if exists or premake.generated then
+			new = slurp(tmpfilename)
+		end
+		if premake.generated then
+			premake.generated[filename] = new
+		end
+
+		-- only replace the file if it has changed, to keep from triggering rebuilds
+		if exists and slurp(filename) == new then
+			os.remove(tmpfilename)
+		else
+			os.remove(filename)
+			os.rename(tmpfilename, filename)
+		end
+	end
+
+
+
+--
+-- Runs an action twice, and compares the files generated each time. A file
+-- which comes out differently depends on something besides the project
+-- scripts, such as table iteration order, and would be rewritten (and so
+-- rebuilt) for no reason.
+--
+-- @param trigger
+--    The action to run.
+-- @returns
+--    True if every file was the same both times; otherwise false and a list
+--    of the files which differed.
+--
+
+	function premake.verifystable(trigger)
+		local runs = { }
+		for i = 1, 2 do
+			premake.generated = { }
+			premake.action.call(trigger)
+			runs[i] = premake.generated
+		end
+		premake.generated = nil
+
+		local names = table.join(table.keys(runs[1]), table.keys(runs[2]))
+		table.sort(names)
+
+		local unstable = { }
+		for i, fname in ipairs(names) do
+			if fname ~= names[i - 1] and runs[1][fname] ~= runs[2][fname] then
+				table.insert(unstable, fname)
+			end
+		end
+
+		if #unstable > 0 then
+			return false, "output is not stable between runs:\n\t" .. table.concat(unstable, "\n\t")
+		end
+		return true
 	end
 
+
+
   --[[
 	function premake.generate(obj, filename, callback)
 		filename = premake.project.getfilename(obj, filename)
@@ -248,7 +248,7 @@
 		prj = prj.project or prj
 		
 		local results = { }
-		for _, cfg in pairs(prj.__configs) do
+		for _, cfg in table.sortedpairs(prj.__configs) do
 			for _, link in ipairs(cfg.links) do
 				local dep = premake.findproject(link)
 				if dep and not table.contains(results, dep) then
@@ -92,6 +92,42 @@
 	end
 
 
+--
+-- Iterates the keys and values of a table in sorted key order, rather than the
+-- unpredictable order of pairs(), so anything written from it comes out the
+-- same on every run. Only string and number keys can be ordered that way;
+-- numbers come before strings.
+--
+
+	local function keyorder(a, b)
+		local ta, tb = type(a), type(b)
+		if ta ~= tb then
+			return ta < tb
+		else
+			return a < b
+		end
+	end
+
+	function table.sortedpairs(tbl)
+		local keys = table.keys(tbl)
+		for _, k in ipairs(keys) do
+			local t = type(k)
+			if t ~= "string" and t ~= "number" then
+				error("table.sortedpairs() can't order a " .. t .. " key", 2)
+			end
+		end
+		table.sort(keys, keyorder)
+		local i = 0
+		return function()
+			i = i + 1
+			local k = keys[i]
+			if k ~= nil then
+				return k, tbl[k]
+			end
+		end
+	end
+
+
 --
 -- Translates the values contained in array, using the specified
 -- translation table, and returns the results in a new array.
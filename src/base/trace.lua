@@ -0,0 +1,186 @@
+--
+-- trace.lua
+-- Records what Premake spends its time on, as Chrome trace events.
+-- Copyright (c) 2002-2009 Jason Perkins and the Premake project
+--
+
+	premake.trace = { }
+
+
+-- The events recorded since premake.trace.start(); nil when not tracing,
+-- which keeps the calls below cheap enough to leave in place.
+
+	local events
+
+
+
+--
+-- Starts a new trace, discarding any previous events.
+--
+
+	function premake.trace.start()
+		events = { }
+	end
+
+
+--
+-- Stops tracing and discards the events.
+--
+
+	function premake.trace.stop()
+		events = nil
+	end
+
+
+--
+-- Returns true if a trace is being recorded.
+--
+
+	function premake.trace.isenabled()
+		return (events ~= nil)
+	end
+
+
+
+--
+-- Marks the start of a span of work. Spans nest; each call must be matched
+-- by a call to premake.trace.finish().
+--
+-- @param name
+--    The name to show for the span, such as a file or project name.
+-- @param category
+--    The kind of work, such as "phase", "dofile", or "generate".
+-- @param args
+--    An optional table of string or number values to attach to the span.
+--
+
+	function premake.trace.begin(name, category, args)
+		if events then
+			table.insert(events, { ph = "B", name = name, cat = category, ts = os.ticks(), args = args })
+		end
+	end
+
+
+--
+-- Marks the end of the most recently begun span.
+--
+-- @param args
+--    An optional table of values to add to those given to begin(), such as
+--    a count of the results.
+--
+
+	function premake.trace.finish(args)
+		if events then
+			table.insert(events, { ph = "E", ts = os.ticks(), args = args })
+		end
+	end
+
+
+
+--
+-- Returns the recorded events in the JSON format read by chrome://tracing
+-- and Perfetto; the times are in microseconds from the start of the trace.
+--
+
+	local function quote(value)
+		if type(value) == "number" then
+			return string.format("%.15g", value)
+		end
+		value = tostring(value):gsub('[%c"\\]', function(c)
+			return string.format("\\u%04x", c:byte())
+		end)
+		return '"' .. value .. '"'
+	end
+
+	function premake.trace.tojson()
+		local lines = { }
+		local start = (events and events[1]) and events[1].ts or 0
+		for _, e in ipairs(events or { }) do
+			local fields = { }
+			if e.name then
+				table.insert(fields, '"name":' .. quote(e.name))
+			end
+			if e.cat then
+				table.insert(fields, '"cat":' .. quote(e.cat))
+			end
+			table.insert(fields, '"ph":"' .. e.ph .. '"')
+			table.insert(fields, '"ts":' .. string.format("%.3f", e.ts - start))
+			table.insert(fields, '"pid":1,"tid":' .. (e.tid or 1))
+			if e.args then
+				local args = { }
+				for k, v in table.sortedpairs(e.args) do
+					table.insert(args, quote(k) .. ":" .. quote(v))
+				end
+				table.insert(fields, '"args":{' .. table.concat(args, ",") .. '}')
+			end
+			table.insert(lines, "{" .. table.concat(fields, ",") .. "}")
+		end
+		return '{"traceEvents":[\n' .. table.concat(lines, ",\n") .. '\n]}\n'
+	end
+
+
+--
+-- Returns the recorded events as the fields of a Lua table constructor, so
+-- a --jobs worker process can hand them back to be added to the main trace.
+--
+
+	local function serialize(value)
+		if type(value) == "table" then
+			local fields = { }
+			for k, v in table.sortedpairs(value) do
+				table.insert(fields, "[" .. serialize(k) .. "]=" .. serialize(v))
+			end
+			return "{" .. table.concat(fields, ",") .. "}"
+		elseif type(value) == "number" then
+			return string.format("%.17g", value)
+		else
+			return string.format("%q", tostring(value))
+		end
+	end
+
+	function premake.trace.serialize()
+		local result = { }
+		for _, e in ipairs(events or { }) do
+			table.insert(result, serialize(e))
+		end
+		return table.concat(result, ",\n")
+	end
+
+
+--
+-- Adds events recorded by another process to the trace.
+--
+-- @param list
+--    The events, as loaded from premake.trace.serialize().
+-- @param tid
+--    The thread ID to show the events under, so they don't interleave with
+--    the events of this process.
+--
+
+	function premake.trace.append(list, tid)
+		if events then
+			for _, e in ipairs(list) do
+				e.tid = tid
+				table.insert(events, e)
+			end
+		end
+	end
+
+
+
+--
+-- Writes the recorded events to a file.
+--
+-- @returns
+--    True if successful, otherwise nil and an error message.
+--
+
+	function premake.trace.save(filename)
+		local f, err = io.open(filename, "wb")
+		if (not f) then
+			return nil, err
+		end
+		f:write(premake.trace.tojson())
+		f:close()
+		return true
+	end
@@ -18,6 +18,8 @@ int os_chdir(lua_State* L)
 	z = !chdir(path);
 #endif
 
+	do_resetcwd();
+
 	if (!z)
 	{
 		lua_pushnil(L);
@@ -5,6 +5,7 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 #include "premake.h"
 
 int os_copyfile(lua_State* L)
@@ -20,6 +21,17 @@ int os_copyfile(lua_State* L)
 	z = (system(lua_tostring(L, -1)) == 0);
 #endif
 
+	/* copying into a directory makes a file there with the source's name */
+	if (do_stat(dst) == STAT_DIR)
+	{
+		const char* name = src + strlen(src);
+		while (name > src && name[-1] != '/' && name[-1] != '\\')
+			--name;
+		lua_pushfstring(L, "%s/%s", dst, name);
+		do_forget(lua_tostring(L, -1));
+	}
+	do_forget(dst);
+
 	if (!z)
 	{
 		lua_pushnil(L);
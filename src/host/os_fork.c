@@ -0,0 +1,91 @@
+/**
+ * \file   os_fork.c
+ * \brief  Run part of the work in a child process, where supported.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "premake.h"
+
+#if !PLATFORM_WINDOWS
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+
+/**
+ * Split the process in two. The child gets a copy of everything, including
+ * the Lua state, and carries on from the same point; it should finish with
+ * os.exit(). Any buffered output is written first, so it isn't repeated by
+ * the child.
+ *
+ *   os.fork()
+ *
+ * \returns The child's process ID in the parent, and zero in the child; or
+ *          nil and a message if the process can't be forked, as on Windows.
+ */
+int os_fork(lua_State* L)
+{
+#if PLATFORM_WINDOWS
+	lua_pushnil(L);
+	lua_pushstring(L, "os.fork() is not supported on Windows");
+	return 2;
+#else
+	pid_t pid;
+
+	fflush(NULL);
+	pid = fork();
+	if (pid < 0)
+	{
+		lua_pushnil(L);
+		lua_pushstring(L, strerror(errno));
+		return 2;
+	}
+
+	lua_pushnumber(L, (lua_Number)pid);
+	return 1;
+#endif
+}
+
+
+/**
+ * Wait for a child process started with os.fork() to finish.
+ *
+ *   os.waitpid(pid)
+ *
+ * \returns The child's exit code; or nil and a message if it was killed
+ *          or can't be waited for.
+ */
+int os_waitpid(lua_State* L)
+{
+#if PLATFORM_WINDOWS
+	lua_pushnil(L);
+	lua_pushstring(L, "os.waitpid() is not supported on Windows");
+	return 2;
+#else
+	pid_t pid = (pid_t)luaL_checknumber(L, 1);
+	int status;
+
+	while (waitpid(pid, &status, 0) < 0)
+	{
+		if (errno != EINTR)
+		{
+			lua_pushnil(L);
+			lua_pushstring(L, strerror(errno));
+			return 2;
+		}
+	}
+
+	if (WIFEXITED(status))
+	{
+		lua_pushnumber(L, WEXITSTATUS(status));
+		return 1;
+	}
+
+	lua_pushnil(L);
+	lua_pushfstring(L, "process %d was terminated by signal %d", (int)pid, WTERMSIG(status));
+	return 2;
+#endif
+}
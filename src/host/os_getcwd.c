@@ -8,27 +8,11 @@
 
 int os_getcwd(lua_State* L)
 {
-	char buffer[0x4000];
-	char* ch;
-	int result;
-
-#if PLATFORM_WINDOWS
-	result = (GetCurrentDirectory(0x4000, buffer) != 0);
-#else
-	result = (getcwd(buffer, 0x4000) != 0);
-#endif
-
-	if (!result)
+	/* looked up once, then remembered until os.chdir() is called */
+	const char* cwd = do_getcwd();
+	if (!cwd)
 		return 0;
 
-	/* convert to platform-neutral directory separators */
-	for (ch = buffer; *ch != '\0'; ++ch)
-	{
-		if (*ch == '\\') *ch = '/';
-	}
-
-	lua_pushstring(L, buffer);
+	lua_pushstring(L, cwd);
 	return 1;
 }
-
-
@@ -0,0 +1,372 @@
+/**
+ * \file   os_globcache.c
+ * \brief  A persistent cache of the directory listings read by os.matchwalk().
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "premake.h"
+#if !PLATFORM_WINDOWS
+#include <pthread.h>
+#endif
+
+
+/*
+ * The cache maps the absolute path of a directory to the names and kinds
+ * of its entries, along with the directory's modification time when it was
+ * read. Adding, removing, or renaming an entry changes that time, so the
+ * listing can be reused for as long as the time still matches.
+ *
+ * The cache file starts with a header line. Each listing follows as a line
+ * "<mtime> <nsec> <count> <length> <path>", then the names block: <length>
+ * bytes holding each entry as a kind digit, the name, and a terminating
+ * NUL. The file is only read and written as a whole.
+ */
+
+#define CACHE_HEADER   "premake-globcache 1\n"
+
+
+static GlobListing** table = NULL;
+static size_t table_size  = 0;
+static size_t table_count = 0;
+static int    enabled = 0;
+static int    dirty   = 0;
+
+#if !PLATFORM_WINDOWS
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+#define cache_lock()     pthread_mutex_lock(&lock)
+#define cache_unlock()   pthread_mutex_unlock(&lock)
+#else
+#define cache_lock()
+#define cache_unlock()
+#endif
+
+
+
+static unsigned long hash_path(const char* path)
+{
+	unsigned long hash = 2166136261UL;
+	while (*path)
+	{
+		hash = (hash ^ (unsigned char)*path++) * 16777619UL;
+	}
+	return hash;
+}
+
+
+static void listing_free(GlobListing* listing)
+{
+	free(listing->path);
+	free(listing->names);
+	free(listing);
+}
+
+
+static GlobListing** table_slot(GlobListing** items, size_t size, const char* path)
+{
+	size_t i = hash_path(path) & (size - 1);
+	while (items[i] && strcmp(items[i]->path, path) != 0)
+	{
+		i = (i + 1) & (size - 1);
+	}
+	return &items[i];
+}
+
+
+/* adds or replaces a listing; the caller must hold the lock */
+static void table_store(GlobListing* listing)
+{
+	GlobListing** slot;
+
+	if ((table_count + 1) * 2 > table_size)
+	{
+		size_t i, size = (table_size) ? table_size * 2 : 256;
+		GlobListing** items = (GlobListing**)calloc(size, sizeof(GlobListing*));
+		for (i = 0; i < table_size; ++i)
+		{
+			if (table[i])
+				*table_slot(items, size, table[i]->path) = table[i];
+		}
+		free(table);
+		table = items;
+		table_size = size;
+	}
+
+	slot = table_slot(table, table_size, listing->path);
+	if (*slot)
+		listing_free(*slot);
+	else
+		table_count++;
+	*slot = listing;
+}
+
+
+static void table_clear()
+{
+	size_t i;
+	for (i = 0; i < table_size; ++i)
+	{
+		if (table[i])
+			listing_free(table[i]);
+	}
+	free(table);
+	table = NULL;
+	table_size  = 0;
+	table_count = 0;
+}
+
+
+
+/*
+ * The walker's interface to the cache.
+ */
+
+int globcache_enabled()
+{
+	return enabled;
+}
+
+
+GlobListing* globcache_find(const char* path, long mtime, long nsec)
+{
+	GlobListing* listing = NULL;
+	cache_lock();
+	if (table)
+	{
+		listing = *table_slot(table, table_size, path);
+		if (listing && (listing->mtime != mtime || listing->nsec != nsec))
+			listing = NULL;
+	}
+	cache_unlock();
+	return listing;
+}
+
+
+GlobListing* globcache_new(const char* path, long mtime, long nsec)
+{
+	GlobListing* listing = (GlobListing*)calloc(1, sizeof(GlobListing));
+	listing->path = (char*)malloc(strlen(path) + 1);
+	strcpy(listing->path, path);
+	listing->mtime = mtime;
+	listing->nsec  = nsec;
+	return listing;
+}
+
+
+void globcache_add(GlobListing* listing, const char* name, int kind)
+{
+	size_t n = strlen(name) + 2;
+	if (listing->length + n > listing->size)
+	{
+		listing->size = (listing->size + n) * 2;
+		listing->names = (char*)realloc(listing->names, listing->size);
+	}
+	listing->names[listing->length] = (char)('0' + kind);
+	strcpy(listing->names + listing->length + 1, name);
+	listing->length += n;
+	listing->count++;
+}
+
+
+/*
+ * Takes ownership of a new listing. A directory modified in the last couple
+ * of seconds might change again without its time changing, if the file
+ * system only keeps whole seconds; those listings are thrown away instead.
+ */
+void globcache_store(GlobListing* listing)
+{
+	if (listing->mtime >= (long)time(NULL) - 1 || strchr(listing->path, '\n'))
+	{
+		listing_free(listing);
+		return;
+	}
+
+	cache_lock();
+	table_store(listing);
+	dirty = 1;
+	cache_unlock();
+}
+
+
+
+/*
+ * Checks a names block read from the cache file: it must hold exactly the
+ * given number of entries, each a kind digit (the walker's kinds run from
+ * 1 to 3) and a name ending in a NUL.
+ */
+static int names_valid(const char* names, unsigned long length, unsigned long count)
+{
+	const char* ch = names;
+	const char* end = names + length;
+	unsigned long i;
+
+	for (i = 0; i < count; ++i)
+	{
+		const char* nul;
+		if (end - ch < 3 || ch[0] < '1' || ch[0] > '3')
+			return 0;
+		nul = (const char*)memchr(ch + 1, '\0', end - ch - 1);
+		if (!nul || nul == ch + 1)
+			return 0;
+		ch = nul + 1;
+	}
+	return (ch == end);
+}
+
+
+
+/**
+ * Turn on the listing cache, and load any listings saved by a previous run.
+ * A missing or unreadable cache file just leaves the cache empty.
+ *
+ *   os.loadglobcache(filename)
+ */
+int os_loadglobcache(lua_State* L)
+{
+	const char* filename = luaL_checkstring(L, 1);
+	char* buffer;
+	const char* ch;
+	const char* end;
+	long size;
+	FILE* file;
+
+	enabled = 1;
+	dirty = 0;
+	table_clear();
+
+	file = fopen(filename, "rb");
+	if (file == NULL)
+		return 0;
+
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+	buffer = (char*)malloc(size + 1);
+	if (size < 0 || fread(buffer, 1, size, file) != (size_t)size)
+		size = 0;
+	buffer[size] = '\0';
+	fclose(file);
+
+	ch  = buffer;
+	end = buffer + size;
+	if (strncmp(ch, CACHE_HEADER, strlen(CACHE_HEADER)) != 0)
+	{
+		free(buffer);
+		return 0;
+	}
+
+	for (ch += strlen(CACHE_HEADER); ch < end; )
+	{
+		GlobListing* listing;
+		const char* eol = (const char*)memchr(ch, '\n', end - ch);
+		long mtime, nsec;
+		unsigned long count, length;
+		int pathstart = 0;
+
+		if (!eol || sscanf(ch, "%ld %ld %lu %lu %n", &mtime, &nsec, &count, &length, &pathstart) != 4 || pathstart == 0)
+			break;
+		if (pathstart >= eol - ch || length > (unsigned long)(end - eol - 1))
+			break;
+		if (!names_valid(eol + 1, length, count))
+			break;
+
+		listing = (GlobListing*)calloc(1, sizeof(GlobListing));
+		listing->path = (char*)malloc(eol - ch - pathstart + 1);
+		memcpy(listing->path, ch + pathstart, eol - ch - pathstart);
+		listing->path[eol - ch - pathstart] = '\0';
+		listing->mtime  = mtime;
+		listing->nsec   = nsec;
+		listing->count  = count;
+		listing->length = listing->size = length;
+		listing->names  = (char*)malloc(length + 1);
+		memcpy(listing->names, eol + 1, length);
+		listing->names[length] = '\0';
+		table_store(listing);
+
+		ch = eol + 1 + length;
+	}
+
+	/* a damaged file is ignored completely; it gets rewritten at the end */
+	if (ch != end)
+	{
+		table_clear();
+		dirty = 1;
+	}
+
+	free(buffer);
+	return 0;
+}
+
+
+
+/**
+ * Write the listing cache out, if anything has changed since it was loaded.
+ * Returns true if the file was written, false if there was no need, or nil
+ * and an error message if the file could not be written.
+ *
+ *   os.saveglobcache(filename)
+ */
+int os_saveglobcache(lua_State* L)
+{
+	const char* filename = luaL_checkstring(L, 1);
+	char* tempname;
+	FILE* file;
+	size_t i;
+	int ok;
+
+	if (!enabled || !dirty)
+	{
+		lua_pushboolean(L, 0);
+		return 1;
+	}
+
+	/* write to the side and rename, so an interrupted run can't leave half a cache */
+	tempname = (char*)malloc(strlen(filename) + 5);
+	strcpy(tempname, filename);
+	strcat(tempname, ".tmp");
+
+	file = fopen(tempname, "wb");
+	if (file == NULL)
+	{
+		free(tempname);
+		lua_pushnil(L);
+		lua_pushfstring(L, "unable to write %s", filename);
+		return 2;
+	}
+
+	ok = (fputs(CACHE_HEADER, file) >= 0);
+	for (i = 0; i < table_size && ok; ++i)
+	{
+		GlobListing* listing = table[i];
+		if (listing)
+		{
+			fprintf(file, "%ld %ld %lu %lu %s\n", listing->mtime, listing->nsec,
+				(unsigned long)listing->count, (unsigned long)listing->length, listing->path);
+			ok = (fwrite(listing->names, 1, listing->length, file) == listing->length);
+		}
+	}
+	ok = (fclose(file) == 0) && ok;
+
+#if PLATFORM_WINDOWS
+	remove(filename);
+#endif
+	if (ok)
+		ok = (rename(tempname, filename) == 0);
+	if (!ok)
+		remove(tempname);
+	free(tempname);
+
+	if (!ok)
+	{
+		lua_pushnil(L);
+		lua_pushfstring(L, "unable to write %s", filename);
+		return 2;
+	}
+
+	dirty = 0;
+	lua_pushboolean(L, 1);
+	return 1;
+}
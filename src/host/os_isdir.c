@@ -5,13 +5,11 @@
  */
 
 #include <string.h>
-#include <sys/stat.h>
 #include "premake.h"
 
 
 int os_isdir(lua_State* L)
 {
-	struct stat buf;
 	const char* path = luaL_checkstring(L, 1);
 
 	/* empty path is equivalent to ".", must be true */
@@ -19,13 +17,9 @@ int os_isdir(lua_State* L)
 	{
 		lua_pushboolean(L, 1);
 	}
-	else if (stat(path, &buf) == 0)
-	{
-		lua_pushboolean(L, buf.st_mode & S_IFDIR);
-	}
 	else
 	{
-		lua_pushboolean(L, 0);
+		lua_pushboolean(L, do_stat(path) == STAT_DIR);
 	}
 
 	return 1;
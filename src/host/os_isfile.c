@@ -4,7 +4,6 @@
  * \author Copyright (c) 2002-2008 Jason Perkins and the Premake project
  */
 
-#include <sys/stat.h>
 #include "premake.h"
 
 
@@ -18,13 +17,5 @@ int os_isfile(lua_State* L)
 
 int do_isfile(const char* filename)
 {
-	struct stat buf;
-	if (stat(filename, &buf) == 0)
-	{
-		return ((buf.st_mode & S_IFDIR) == 0);
-	}
-	else
-	{
-		return 0;
-	}
+	return (do_stat(filename) == STAT_FILE);
 }
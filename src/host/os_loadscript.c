@@ -0,0 +1,229 @@
+/**
+ * \file   os_loadscript.c
+ * \brief  Compile a script file, reusing a cached copy of its bytecode.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "premake.h"
+
+
+/*
+ * Each script gets one cache file, named for the SHA-1 of its path. The file
+ * starts with a header line holding the SHA-1 of the script's contents, and
+ * the bytecode follows. The bytecode is only used if the contents still
+ * match; otherwise the script is compiled and the cache file replaced.
+ */
+
+#define CACHE_HEADER   "premake-scriptcache 1 "
+
+
+typedef struct struct_Buffer
+{
+	char*  data;
+	size_t length;
+	size_t size;
+} Buffer;
+
+
+static int buffer_writer(lua_State* L, const void* p, size_t sz, void* ud)
+{
+	Buffer* buffer = (Buffer*)ud;
+	(void)L;
+	if (buffer->length + sz > buffer->size)
+	{
+		buffer->size = (buffer->length + sz) * 2;
+		buffer->data = (char*)realloc(buffer->data, buffer->size);
+	}
+	memcpy(buffer->data + buffer->length, p, sz);
+	buffer->length += sz;
+	return 0;
+}
+
+
+static int read_file(const char* filename, Buffer* buffer)
+{
+	long size;
+	FILE* file = fopen(filename, "rb");
+	if (file == NULL)
+		return 0;
+
+	fseek(file, 0, SEEK_END);
+	size = ftell(file);
+	fseek(file, 0, SEEK_SET);
+
+	buffer->data = (char*)malloc((size > 0) ? size : 1);
+	buffer->length = buffer->size = (size > 0) ? (size_t)size : 0;
+	if (size < 0 || fread(buffer->data, 1, buffer->length, file) != buffer->length)
+	{
+		fclose(file);
+		free(buffer->data);
+		return 0;
+	}
+
+	fclose(file);
+	return 1;
+}
+
+
+/*
+ * Create the cache directory, and any of its parents which are missing.
+ */
+static void make_dirs(const char* dir)
+{
+	char* path = (char*)malloc(strlen(dir) + 1);
+	char* ch;
+	strcpy(path, dir);
+
+	for (ch = path + 1; ; ++ch)
+	{
+		if (*ch == '/' || *ch == '\\' || *ch == '\0')
+		{
+			char sep = *ch;
+			*ch = '\0';
+			if (do_stat(path) != STAT_DIR)
+			{
+#if PLATFORM_WINDOWS
+				if (CreateDirectory(path, NULL))
+#else
+				if (mkdir(path, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH) == 0)
+#endif
+					do_remember(path, STAT_DIR);
+			}
+			*ch = sep;
+			if (sep == '\0')
+				break;
+		}
+	}
+
+	free(path);
+}
+
+
+static void format_digest(const void* data, size_t length, char hex[41])
+{
+	unsigned char digest[20];
+	int i;
+	do_sha1(data, length, digest);
+	for (i = 0; i < 20; ++i)
+		sprintf(hex + i * 2, "%02x", digest[i]);
+}
+
+
+
+/**
+ * Compile a script file and return it as a function, like loadfile(). Given
+ * a cache directory, the compiled bytecode is saved there and reused for as
+ * long as the script is unchanged. The directory is created the first time
+ * something is saved there; if the cache can't be read or written the script
+ * is simply compiled.
+ *
+ *   os.loadscript(filename, [cachedir])
+ */
+int os_loadscript(lua_State* L)
+{
+	const char* filename = luaL_checkstring(L, 1);
+	const char* cachedir = luaL_optstring(L, 2, NULL);
+	const char* chunkname;
+	const char* source;
+	char digest[41];
+	char* cachename = NULL;
+	Buffer script, cached, compiled;
+	int top, z;
+
+	if (!read_file(filename, &script))
+	{
+		lua_pushnil(L);
+		lua_pushfstring(L, "cannot open %s", filename);
+		return 2;
+	}
+
+	chunkname = lua_pushfstring(L, "@%s", filename);
+	top = lua_gettop(L);
+
+	if (cachedir)
+	{
+		char pathdigest[41];
+		format_digest(filename, strlen(filename), pathdigest);
+		format_digest(script.data, script.length, digest);
+		cachename = (char*)malloc(strlen(cachedir) + 48);
+		sprintf(cachename, "%s/%s.luac", cachedir, pathdigest);
+
+		/* use the saved copy, if the script hasn't changed since */
+		if (read_file(cachename, &cached))
+		{
+			size_t headerlen = strlen(CACHE_HEADER) + 41;
+			if (cached.length > headerlen &&
+				memcmp(cached.data, CACHE_HEADER, strlen(CACHE_HEADER)) == 0 &&
+				memcmp(cached.data + strlen(CACHE_HEADER), digest, 40) == 0 &&
+				luaL_loadbuffer(L, cached.data + headerlen, cached.length - headerlen, chunkname) == OKAY)
+			{
+				free(cached.data);
+				free(script.data);
+				free(cachename);
+				return 1;
+			}
+			free(cached.data);
+			lua_settop(L, top);
+		}
+	}
+
+	/* skip any #! line, as loadfile() does, but keep the line count right */
+	source = script.data;
+	if (script.length > 0 && source[0] == '#')
+	{
+		while (source < script.data + script.length && *source != '\n')
+			++source;
+	}
+
+	z = luaL_loadbuffer(L, source, script.length - (source - script.data), chunkname);
+	free(script.data);
+	if (z != OKAY)
+	{
+		free(cachename);
+		lua_pushnil(L);
+		lua_insert(L, -2);
+		return 2;
+	}
+
+	if (cachename)
+	{
+		compiled.data = NULL;
+		compiled.length = compiled.size = 0;
+		buffer_writer(L, CACHE_HEADER, strlen(CACHE_HEADER), &compiled);
+		buffer_writer(L, digest, 40, &compiled);
+		buffer_writer(L, "\n", 1, &compiled);
+		if (lua_dump(L, buffer_writer, &compiled) == 0)
+		{
+			/* write to the side and rename, so a half-written file is never read */
+			char* tempname = (char*)malloc(strlen(cachename) + 5);
+			FILE* file;
+			strcpy(tempname, cachename);
+			strcat(tempname, ".tmp");
+			file = fopen(tempname, "wb");
+			if (!file)
+			{
+				make_dirs(cachedir);
+				file = fopen(tempname, "wb");
+			}
+			if (file)
+			{
+				int ok = (fwrite(compiled.data, 1, compiled.length, file) == compiled.length);
+				ok = (fclose(file) == 0) && ok;
+#if PLATFORM_WINDOWS
+				remove(cachename);
+#endif
+				if (!ok || rename(tempname, cachename) != 0)
+					remove(tempname);
+			}
+			free(tempname);
+		}
+		free(compiled.data);
+		free(cachename);
+	}
+
+	return 1;
+}
@@ -181,3 +181,1424 @@ int os_matchnext(lua_State* L)
 }
 
 #endif
+
+
+
+/*
+ * Recursive matching, used by os.matchfiles() and os.matchdirs().
+ *
+ * All of the masks passed to a single call are compiled into one set of
+ * rules, each holding the directory prefix the rule applies to, a pattern
+ * for entry names, and whether it recurses. Masks which share a prefix, or
+ * fall under the prefix of a recursive mask, are served by the same walk,
+ * so the tree is read once no matter how many masks are given.
+ *
+ * Each directory visited by a walk becomes a node, holding the sorted names
+ * of the entries that matched and the sorted list of its subdirectories.
+ * Nodes are read by a small pool of worker threads, each of which owns a
+ * queue of directories; an idle worker steals from the front of another
+ * worker's queue. Once every node has been read the tree is emitted into
+ * the Lua result table in pre-order, so the results are always the same no
+ * matter which thread read which directory.
+ */
+
+#if !PLATFORM_WINDOWS
+#include <dirent.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#endif
+#include <ctype.h>
+#include <stdio.h>
+
+
+/*
+ * Entry classifications. Only regular files count as files; everything else
+ * (including entries which can't be examined) counts as a directory, which
+ * is how the original script-side matching behaved.
+ */
+#define KIND_FILE    (1)
+#define KIND_DIR     (2)
+#define KIND_OTHER   (3)
+
+/*
+ * Compiled pattern types, from cheapest to most expensive to test.
+ */
+#define PATTERN_ALL      (1)
+#define PATTERN_LITERAL  (2)
+#define PATTERN_SUFFIX   (3)
+#define PATTERN_GLOB     (4)
+
+/*
+ * The folder holding the script and directory listing caches, which the
+ * recursive masks never look into.
+ */
+#define CACHE_DIRNAME    ".premake"
+
+#if PLATFORM_MACOSX
+#define MTIME_NSEC(info)   ((info).st_mtimespec.tv_nsec)
+#else
+#define MTIME_NSEC(info)   ((info).st_mtim.tv_nsec)
+#endif
+
+#define MAX_WALK_THREADS   (64)
+#define DEFAULT_THREADS    (16)
+
+
+typedef struct struct_NameList
+{
+	char** items;
+	size_t count;
+	size_t size;
+} NameList;
+
+
+typedef struct struct_MatchRule
+{
+	char*       prefix;
+	size_t      len;
+	const char* pattern;
+	int         type;
+	const char* literal;
+	size_t      litlen;
+	int         recurse;
+	int         anchored;
+	int         dironly;
+	int         mask;
+} MatchRule;
+
+
+typedef struct struct_RuleList
+{
+	MatchRule* items;
+	size_t     count;
+	size_t     size;
+} RuleList;
+
+
+typedef struct struct_WalkNode
+{
+	struct struct_WalkNode*  parent;
+	char*                    path;
+	size_t                   len;
+	NameList                 matches;
+	RuleList                 ignores;
+	struct struct_WalkNode** children;
+	size_t                   numchildren;
+#if !PLATFORM_WINDOWS
+	dev_t                    dev;
+	ino_t                    ino;
+#endif
+} WalkNode;
+
+
+typedef struct struct_WalkQueue
+{
+	WalkNode** items;
+	size_t     head;
+	size_t     tail;
+	size_t     size;
+#if !PLATFORM_WINDOWS
+	pthread_mutex_t lock;
+#endif
+} WalkQueue;
+
+
+typedef struct struct_Walk
+{
+	RuleList    rules;
+	RuleList    excludes;
+	const char* ignorefile;
+	char*       cwd;
+	int         wantfiles;
+	int         numworkers;
+	WalkQueue*  queues;
+	int         pending;
+	int         idle;
+	int         pushes;
+#if !PLATFORM_WINDOWS
+	pthread_mutex_t lock;
+	pthread_cond_t  wake;
+#endif
+} Walk;
+
+
+typedef struct struct_WalkWorker
+{
+	Walk* walk;
+	int   id;
+} WalkWorker;
+
+
+/*
+ * A directory entry being considered by the walk. The kind is filled in
+ * on demand, since working it out may cost a system call.
+ */
+typedef struct struct_WalkEntry
+{
+	const char*    name;
+	int            kind;
+#if !PLATFORM_WINDOWS
+	DIR*           dir;
+	struct dirent* dirent;
+#endif
+} WalkEntry;
+
+
+
+/*
+ * Names can carry a tag, such as the mask a match came from. It is kept in
+ * the same allocation, just past the terminating null, so it follows the
+ * name around when the list is sorted.
+ */
+static void names_addtagged(NameList* list, const char* name, int tag)
+{
+	size_t n = strlen(name) + 1;
+	if (list->count == list->size)
+	{
+		list->size = (list->size) ? list->size * 2 : 16;
+		list->items = (char**)realloc(list->items, list->size * sizeof(char*));
+	}
+	list->items[list->count] = (char*)malloc(n + sizeof(int));
+	memcpy(list->items[list->count], name, n);
+	memcpy(list->items[list->count] + n, &tag, sizeof(int));
+	list->count++;
+}
+
+
+static void names_add(NameList* list, const char* name)
+{
+	names_addtagged(list, name, 0);
+}
+
+
+static int names_gettag(const char* name)
+{
+	int tag;
+	memcpy(&tag, name + strlen(name) + 1, sizeof(int));
+	return tag;
+}
+
+
+static int names_compare(const void* a, const void* b)
+{
+	return strcmp(*(const char**)a, *(const char**)b);
+}
+
+
+static void names_sort(NameList* list)
+{
+	if (list->count > 1)
+		qsort(list->items, list->count, sizeof(char*), names_compare);
+}
+
+
+static void names_free(NameList* list)
+{
+	size_t i;
+	for (i = 0; i < list->count; ++i)
+		free(list->items[i]);
+	free(list->items);
+}
+
+
+
+/*
+ * Pattern matching. '*' matches any run of characters other than '/', '**'
+ * matches any run of characters at all, '?' matches any single character
+ * other than '/', and [...] matches one character from a set. Windows file
+ * names are matched without regard to case.
+ */
+
+static int chars_equal(char a, char b)
+{
+#if PLATFORM_WINDOWS
+	return (tolower((unsigned char)a) == tolower((unsigned char)b));
+#else
+	return (a == b);
+#endif
+}
+
+
+static int is_special(char ch)
+{
+#if PLATFORM_WINDOWS
+	return (ch == '*' || ch == '?' || ch == '[');
+#else
+	return (ch == '*' || ch == '?' || ch == '[' || ch == '\\');
+#endif
+}
+
+
+/* returns 1 on a match, 0 on no match, -1 if the set isn't terminated */
+static int match_set(const char** pattern, char ch)
+{
+	const char* p = *pattern + 1;
+	int negate = 0, matched = 0;
+
+	if (*p == '!' || *p == '^')
+	{
+		negate = 1;
+		++p;
+	}
+
+	do
+	{
+		if (*p == '\0')
+			return -1;
+		if (p[1] == '-' && p[2] != ']' && p[2] != '\0')
+		{
+#if PLATFORM_WINDOWS
+			int lower = tolower((unsigned char)ch);
+			if (lower >= tolower((unsigned char)p[0]) && lower <= tolower((unsigned char)p[2]))
+				matched = 1;
+#else
+			if (ch >= p[0] && ch <= p[2])
+				matched = 1;
+#endif
+			p += 3;
+		}
+		else
+		{
+			if (chars_equal(*p, ch))
+				matched = 1;
+			++p;
+		}
+	}
+	while (*p != ']');
+
+	*pattern = p + 1;
+	return (matched != negate);
+}
+
+
+static int glob_match(const char* p, const char* s)
+{
+	for (;;)
+	{
+		switch (*p)
+		{
+		case '\0':
+			return (*s == '\0');
+
+		case '*':
+			if (p[1] == '*')
+			{
+				while (*p == '*') ++p;
+				for (;; ++s)
+				{
+					if (glob_match(p, s)) return 1;
+					if (*s == '\0') return 0;
+				}
+			}
+			++p;
+			for (;; ++s)
+			{
+				if (glob_match(p, s)) return 1;
+				if (*s == '\0' || *s == '/') return 0;
+			}
+
+		case '?':
+			if (*s == '\0' || *s == '/') return 0;
+			++p;
+			++s;
+			break;
+
+		case '[':
+			if (*s != '\0' && *s != '/')
+			{
+				int result = match_set(&p, *s);
+				if (result == 0) return 0;
+				if (result == 1)
+				{
+					++s;
+					break;
+				}
+			}
+			if (!chars_equal(*p, *s)) return 0;
+			++p;
+			++s;
+			break;
+
+#if !PLATFORM_WINDOWS
+		case '\\':
+			if (p[1] != '\0') ++p;
+			if (*p != *s) return 0;
+			++p;
+			++s;
+			break;
+#endif
+
+		default:
+			if (!chars_equal(*p, *s)) return 0;
+			++p;
+			++s;
+			break;
+		}
+	}
+}
+
+
+
+/*
+ * Compile a pattern, recognizing the common shapes which don't need the
+ * full matcher: "*", a literal name, or "*" followed by a literal suffix.
+ */
+static void rule_compile(MatchRule* rule, const char* pattern)
+{
+	const char* ch;
+	const char* tail = pattern;
+
+	rule->pattern = pattern;
+	while (*tail == '*') ++tail;
+	for (ch = tail; *ch; ++ch)
+	{
+		if (is_special(*ch))
+		{
+			rule->type = PATTERN_GLOB;
+			return;
+		}
+	}
+
+	rule->literal = tail;
+	rule->litlen  = strlen(tail);
+	if (*tail == '\0')
+		rule->type = PATTERN_ALL;
+	else if (tail == pattern)
+		rule->type = PATTERN_LITERAL;
+	else if (tail - pattern == 1 && strchr(tail, '/'))
+		rule->type = PATTERN_GLOB;  /* a single '*' can't span directories */
+	else
+		rule->type = PATTERN_SUFFIX;
+}
+
+
+static int rule_match(MatchRule* rule, const char* s, size_t len)
+{
+	size_t i;
+	const char* tail;
+
+	switch (rule->type)
+	{
+	case PATTERN_ALL:
+		return 1;
+	case PATTERN_LITERAL:
+	case PATTERN_SUFFIX:
+		if (len < rule->litlen || (rule->type == PATTERN_LITERAL && len != rule->litlen))
+			return 0;
+		tail = s + len - rule->litlen;
+		for (i = 0; i < rule->litlen; ++i)
+		{
+			if (!chars_equal(tail[i], rule->literal[i]))
+				return 0;
+		}
+		return 1;
+	default:
+		return glob_match(rule->pattern, s);
+	}
+}
+
+
+static MatchRule* rules_add(RuleList* list)
+{
+	if (list->count == list->size)
+	{
+		list->size = (list->size) ? list->size * 2 : 16;
+		list->items = (MatchRule*)realloc(list->items, list->size * sizeof(MatchRule));
+	}
+	memset(&list->items[list->count], 0, sizeof(MatchRule));
+	return &list->items[list->count++];
+}
+
+
+static void rules_free(RuleList* list)
+{
+	size_t i;
+	for (i = 0; i < list->count; ++i)
+		free(list->items[i].prefix);
+	free(list->items);
+}
+
+
+
+/*
+ * Add an include mask to the rule list, splitting it into the directory
+ * prefix (as it will appear in the results) and the name pattern. The mask
+ * may only contain wildcards in its final component; a "**" anywhere makes
+ * the rule recursive.
+ */
+static void add_include(RuleList* list, const char* mask)
+{
+	MatchRule* rule = rules_add(list);
+	const char* split = strrchr(mask, '/');
+	size_t len = 0;
+#if PLATFORM_WINDOWS
+	if (strrchr(mask, '\\') > split)
+		split = strrchr(mask, '\\');
+#endif
+
+	/* a directory of "." is dropped from the results */
+	if (split && !(split == mask + 1 && mask[0] == '.'))
+		len = split - mask + 1;
+
+	rule->prefix = (char*)malloc(strlen(mask) + 2);
+	memcpy(rule->prefix, mask, len);
+	rule->prefix[len] = '\0';
+	rule->len = len;
+	rule->recurse = (strstr(mask, "**") != NULL);
+
+	/* the pattern lives in the same allocation, just past the prefix */
+	strcpy(rule->prefix + len + 1, (split) ? split + 1 : mask);
+	rule_compile(rule, rule->prefix + len + 1);
+}
+
+
+/*
+ * Set up an exclusion rule from the first len characters of a pattern. A
+ * trailing '/' limits the rule to directories.
+ */
+static void exclude_init(MatchRule* rule, const char* pattern, size_t len, int anchored)
+{
+	if (len > 1 && pattern[len - 1] == '/')
+	{
+		rule->dironly = 1;
+		--len;
+	}
+
+	rule->prefix = (char*)malloc(len + 1);
+	memcpy(rule->prefix, pattern, len);
+	rule->prefix[len] = '\0';
+	rule->anchored = anchored || (memchr(rule->prefix, '/', len) != NULL);
+	rule->recurse = (strstr(rule->prefix, "**") != NULL);
+	rule_compile(rule, rule->prefix);
+}
+
+
+/*
+ * Add an exclusion. A pattern containing a '/' is matched against the full
+ * path of each entry, as it would appear in the results; otherwise it is
+ * matched against the entry name, at any depth. Excluded directories are
+ * not descended into.
+ */
+static void add_exclude(RuleList* list, const char* pattern)
+{
+	exclude_init(rules_add(list), pattern, strlen(pattern), 0);
+}
+
+
+/*
+ * Add one line of a .gitignore-style file. Blank lines and comments are
+ * skipped, as are negated ("!") patterns, which aren't supported. Patterns
+ * with a leading or embedded '/' are relative to the file's directory.
+ */
+static void add_ignore(RuleList* list, const char* line)
+{
+	size_t len = strlen(line);
+	int anchored = 0;
+
+	while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r' || line[len - 1] == ' ' || line[len - 1] == '\t'))
+		--len;
+	if (len == 0 || line[0] == '#' || line[0] == '!')
+		return;
+
+	if (len > 3 && strncmp(line, "**/", 3) == 0 && !memchr(line + 3, '/', len - 4))
+	{
+		/* a leading "**" directory matches at any depth, like a plain name */
+		line += 3;
+		len  -= 3;
+	}
+	else if (line[0] == '/')
+	{
+		anchored = 1;
+		++line;
+		--len;
+	}
+
+	if (len > 0)
+		exclude_init(rules_add(list), line, len, anchored);
+}
+
+
+/*
+ * Expand any brace alternatives in a mask ("**.{c,cpp,h}") and pass each
+ * resulting mask to the callback. Braces without a comma are left alone.
+ */
+static void expand_braces(const char* mask, RuleList* list, void (*add)(RuleList*, const char*))
+{
+	const char* open;
+	for (open = strchr(mask, '{'); open; open = strchr(open + 1, '{'))
+	{
+		const char* ch;
+		const char* commas[256];
+		int depth = 0, numcommas = 0;
+
+		for (ch = open + 1; *ch; ++ch)
+		{
+			if (*ch == '{')
+				depth++;
+			else if (*ch == '}' && depth-- == 0)
+				break;
+			else if (*ch == ',' && depth == 0 && numcommas < 255)
+				commas[numcommas++] = ch;
+		}
+
+		if (*ch == '}' && numcommas > 0)
+		{
+			const char* close = ch;
+			size_t before = open - mask;
+			size_t after = strlen(close + 1);
+			int i;
+
+			commas[numcommas] = close;
+			for (i = 0; i <= numcommas; ++i)
+			{
+				const char* start = (i == 0) ? open + 1 : commas[i - 1] + 1;
+				size_t n = commas[i] - start;
+				char* expanded = (char*)malloc(before + n + after + 1);
+				memcpy(expanded, mask, before);
+				memcpy(expanded + before, start, n);
+				strcpy(expanded + before + n, close + 1);
+				expand_braces(expanded, list, add);
+				free(expanded);
+			}
+			return;
+		}
+	}
+
+	add(list, mask);
+}
+
+
+static void add_masks(lua_State* L, int index, RuleList* list, void (*add)(RuleList*, const char*))
+{
+	if (lua_istable(L, index))
+	{
+		int i, n = luaL_getn(L, index);
+		for (i = 1; i <= n; ++i)
+		{
+			size_t first = list->count, k;
+			lua_rawgeti(L, index, i);
+			if (lua_isstring(L, -1))
+				expand_braces(lua_tostring(L, -1), list, add);
+			lua_pop(L, 1);
+			for (k = first; k < list->count; ++k)
+				list->items[k].mask = i;
+		}
+	}
+	else if (lua_isstring(L, index))
+	{
+		size_t k;
+		expand_braces(lua_tostring(L, index), list, add);
+		for (k = 0; k < list->count; ++k)
+			list->items[k].mask = 1;
+	}
+}
+
+
+
+static WalkNode* node_new(WalkNode* parent, const char* path, size_t len)
+{
+	WalkNode* node = (WalkNode*)calloc(1, sizeof(WalkNode));
+	node->parent = parent;
+	node->len    = len;
+	node->path   = (char*)malloc(len + 1);
+	memcpy(node->path, path, len);
+	node->path[len] = '\0';
+	return node;
+}
+
+
+static WalkNode* node_child(WalkNode* parent, const char* name)
+{
+	size_t n = strlen(name);
+	WalkNode* node = node_new(parent, parent->path, parent->len);
+	node->path = (char*)realloc(node->path, parent->len + n + 2);
+	memcpy(node->path + parent->len, name, n);
+	node->path[parent->len + n] = '/';
+	node->path[parent->len + n + 1] = '\0';
+	node->len = parent->len + n + 1;
+	return node;
+}
+
+
+
+/*
+ * Synchronization helpers; on Windows the walk always runs on the calling
+ * thread, so these collapse to nothing.
+ */
+
+#if PLATFORM_WINDOWS
+#define walk_lock(m)
+#define walk_unlock(m)
+#else
+#define walk_lock(m)     pthread_mutex_lock(m)
+#define walk_unlock(m)   pthread_mutex_unlock(m)
+#endif
+
+
+static void walk_push(Walk* w, int id, WalkNode* node)
+{
+	WalkQueue* q = &w->queues[id];
+	walk_lock(&q->lock);
+	if (q->tail == q->size)
+	{
+		/* compact before growing; the head moves forward as nodes are stolen */
+		if (q->head > 0)
+		{
+			memmove(q->items, q->items + q->head, (q->tail - q->head) * sizeof(WalkNode*));
+			q->tail -= q->head;
+			q->head = 0;
+		}
+		if (q->tail == q->size)
+		{
+			q->size = (q->size) ? q->size * 2 : 64;
+			q->items = (WalkNode**)realloc(q->items, q->size * sizeof(WalkNode*));
+		}
+	}
+	q->items[q->tail++] = node;
+	walk_unlock(&q->lock);
+
+	walk_lock(&w->lock);
+	w->pending++;
+	w->pushes++;
+#if !PLATFORM_WINDOWS
+	if (w->idle > 0)
+		pthread_cond_signal(&w->wake);
+#endif
+	walk_unlock(&w->lock);
+}
+
+
+static WalkNode* walk_take(Walk* w, int id)
+{
+	WalkNode* node = NULL;
+	int i;
+
+	/* newest first from my own queue, which keeps the walk depth-first */
+	WalkQueue* q = &w->queues[id];
+	walk_lock(&q->lock);
+	if (q->tail > q->head)
+		node = q->items[--q->tail];
+	walk_unlock(&q->lock);
+
+	/* otherwise steal the oldest directory from another worker */
+	for (i = 1; !node && i < w->numworkers; ++i)
+	{
+		q = &w->queues[(id + i) % w->numworkers];
+		walk_lock(&q->lock);
+		if (q->tail > q->head)
+			node = q->items[q->head++];
+		walk_unlock(&q->lock);
+	}
+
+	return node;
+}
+
+
+static WalkNode* walk_next(Walk* w, int id)
+{
+	for (;;)
+	{
+		WalkNode* node;
+		int pushes;
+
+		walk_lock(&w->lock);
+		pushes = w->pushes;
+		walk_unlock(&w->lock);
+
+		node = walk_take(w, id);
+		if (node)
+			return node;
+
+		/* nothing to do; finished if no directories are outstanding, else wait */
+		walk_lock(&w->lock);
+		if (w->pending == 0)
+		{
+			walk_unlock(&w->lock);
+			return NULL;
+		}
+#if !PLATFORM_WINDOWS
+		if (pushes == w->pushes)
+		{
+			w->idle++;
+			pthread_cond_wait(&w->wake, &w->lock);
+			w->idle--;
+		}
+#endif
+		walk_unlock(&w->lock);
+	}
+}
+
+
+static void walk_finish(Walk* w)
+{
+	walk_lock(&w->lock);
+	w->pending--;
+#if !PLATFORM_WINDOWS
+	if (w->pending == 0)
+		pthread_cond_broadcast(&w->wake);
+#endif
+	walk_unlock(&w->lock);
+}
+
+
+
+#if !PLATFORM_WINDOWS
+/*
+ * Classify a directory entry. Where the file system fills in d_type the
+ * answer is free; otherwise (and for symbolic links, which are followed to
+ * match the old stat() based behavior) fall back to fstatat().
+ */
+static int entry_kind(WalkEntry* e)
+{
+	struct stat info;
+	if (e->kind)
+		return e->kind;
+
+	e->kind = KIND_OTHER;
+#if defined(DT_UNKNOWN)
+	if (e->dirent->d_type == DT_REG)
+		e->kind = KIND_FILE;
+	else if (e->dirent->d_type == DT_DIR)
+		e->kind = KIND_DIR;
+	else if (e->dirent->d_type != DT_UNKNOWN && e->dirent->d_type != DT_LNK)
+		e->kind = KIND_OTHER;
+	else
+#endif
+	if (fstatat(dirfd(e->dir), e->name, &info, 0) == 0)
+	{
+		if (S_ISREG(info.st_mode))
+			e->kind = KIND_FILE;
+		else if (S_ISDIR(info.st_mode))
+			e->kind = KIND_DIR;
+	}
+
+	return e->kind;
+}
+#else
+#define entry_kind(e)   ((e)->kind)
+#endif
+
+
+/*
+ * Test an entry against one exclusion rule. Anchored rules are matched
+ * against the path, which has room for a trailing separator: that lets a
+ * rule ending in "**" prune the directory it names as well as its contents.
+ */
+static int exclude_match(MatchRule* rule, WalkEntry* e, size_t namelen, char* path, size_t len)
+{
+	int matched;
+
+	if (rule->dironly && entry_kind(e) != KIND_DIR)
+		return 0;
+	if (!rule->anchored)
+		return rule_match(rule, e->name, namelen);
+
+	matched = rule_match(rule, path, len);
+	if (!matched && rule->recurse && entry_kind(e) == KIND_DIR)
+	{
+		path[len] = '/';
+		path[len + 1] = '\0';
+		matched = rule_match(rule, path, len + 1);
+		path[len] = '\0';
+	}
+	return matched;
+}
+
+
+/*
+ * Check an entry against the exclusions passed to the walk, which are
+ * anchored at the start of the result paths, and against the ignore files
+ * read from this directory and its ancestors, each anchored at its own
+ * directory.
+ */
+static int walk_excluded(Walk* w, WalkNode* node, WalkEntry* e)
+{
+	char buffer[1024];
+	char* fullpath;
+	size_t i, n = strlen(e->name);
+	size_t len = node->len + n;
+	WalkNode* dir;
+	int excluded = 0;
+
+	fullpath = (len + 2 <= sizeof(buffer)) ? buffer : (char*)malloc(len + 2);
+	memcpy(fullpath, node->path, node->len);
+	strcpy(fullpath + node->len, e->name);
+
+	for (i = 0; i < w->excludes.count && !excluded; ++i)
+	{
+		excluded = exclude_match(&w->excludes.items[i], e, n, fullpath, len);
+	}
+
+	for (dir = node; dir && !excluded; dir = dir->parent)
+	{
+		for (i = 0; i < dir->ignores.count && !excluded; ++i)
+		{
+			excluded = exclude_match(&dir->ignores.items[i], e, n, fullpath + dir->len, len - dir->len);
+		}
+	}
+
+	if (fullpath != buffer)
+		free(fullpath);
+	return excluded;
+}
+
+
+/*
+ * Load the ignore file, if there is one, from the directory being read.
+ */
+static void walk_readignores(Walk* w, WalkNode* node)
+{
+	char line[1024];
+	char* filename;
+	FILE* file;
+
+	filename = (char*)malloc(node->len + strlen(w->ignorefile) + 1);
+	memcpy(filename, node->path, node->len);
+	strcpy(filename + node->len, w->ignorefile);
+	file = fopen(filename, "r");
+	free(filename);
+
+	if (file != NULL)
+	{
+		while (fgets(line, sizeof(line), file))
+			add_ignore(&node->ignores, line);
+		fclose(file);
+	}
+}
+
+
+/*
+ * Decide what to do with one directory entry: add it to the node's matches
+ * if any of the active rules want it, and queue it up as a subdirectory if
+ * the walk continues below this node.
+ */
+static void walk_entry(Walk* w, WalkNode* node, WalkEntry* e, MatchRule** active, size_t numactive, int descend, NameList* dirs)
+{
+	size_t i, n = strlen(e->name);
+
+	/* Premake's own caches are kept beside the script, and aren't part of
+	   the project; a "**" mask passes them by */
+	if (descend && strcmp(e->name, CACHE_DIRNAME) == 0)
+		return;
+
+	if ((w->excludes.count > 0 || w->ignorefile) && walk_excluded(w, node, e))
+		return;
+
+	/* an entry is listed once for each mask it matches; the rules from one
+	   mask sit together, so the rest of that mask's rules can be passed by */
+	for (i = 0; i < numactive; ++i)
+	{
+		if (rule_match(active[i], e->name, n))
+		{
+			int kind = entry_kind(e);
+			int mask = active[i]->mask;
+			if ((w->wantfiles) ? (kind == KIND_FILE) : (kind != KIND_FILE))
+				names_addtagged(&node->matches, e->name, mask);
+			else
+				break;
+			while (i + 1 < numactive && active[i + 1]->mask == mask)
+				++i;
+		}
+	}
+
+	if (descend && entry_kind(e) == KIND_DIR)
+		names_add(dirs, e->name);
+}
+
+
+#if !PLATFORM_WINDOWS
+/*
+ * Helpers for reading a directory. The node path carries a trailing
+ * separator, which is dropped while the directory is opened.
+ */
+static DIR* walk_opendir(WalkNode* node)
+{
+	DIR* dir;
+	if (node->len == 0)
+		return opendir(".");
+
+	node->path[node->len - 1] = '\0';
+	dir = opendir(node->len > 1 ? node->path : "/");
+	node->path[node->len - 1] = '/';
+	return dir;
+}
+
+
+static int walk_stat(WalkNode* node, struct stat* info)
+{
+	int result;
+	if (node->len == 0)
+		return stat(".", info);
+
+	node->path[node->len - 1] = '\0';
+	result = stat(node->len > 1 ? node->path : "/", info);
+	node->path[node->len - 1] = '/';
+	return result;
+}
+
+
+/*
+ * Record the identity of a directory, and check that it isn't already one
+ * of its own ancestors; a symbolic link back up the tree would otherwise
+ * recurse forever.
+ */
+static int walk_isloop(WalkNode* node, struct stat* info)
+{
+	WalkNode* parent;
+	node->dev = info->st_dev;
+	node->ino = info->st_ino;
+	for (parent = node->parent; parent; parent = parent->parent)
+	{
+		if (parent->dev == node->dev && parent->ino == node->ino)
+			return 1;
+	}
+	return 0;
+}
+
+
+/*
+ * Listings are cached by absolute path, with the trailing separator.
+ */
+static char* walk_cachekey(Walk* w, WalkNode* node)
+{
+	size_t n = strlen(w->cwd);
+	char* key = (char*)malloc(n + node->len + 2);
+	if (node->path[0] == '/')
+	{
+		strcpy(key, node->path);
+	}
+	else
+	{
+		strcpy(key, w->cwd);
+		if (n == 0 || key[n - 1] != '/')
+			key[n++] = '/';
+		strcpy(key + n, node->path);
+	}
+	return key;
+}
+#endif
+
+
+static void walk_read(Walk* w, WalkNode* node, NameList* dirs)
+{
+	MatchRule* stackrules[32];
+	MatchRule** active = stackrules;
+	size_t i, numactive = 0;
+	int descend = 0;
+	WalkEntry e;
+#if PLATFORM_WINDOWS
+	WIN32_FIND_DATA entry;
+	HANDLE handle;
+	char* search;
+#else
+	struct stat info;
+	GlobListing* cached = NULL;
+	char* key = NULL;
+	DIR* dir;
+#endif
+
+	/* which rules apply here, and do any of them continue further down? */
+	if (w->rules.count > 32)
+		active = (MatchRule**)malloc(w->rules.count * sizeof(MatchRule*));
+	for (i = 0; i < w->rules.count; ++i)
+	{
+		MatchRule* rule = &w->rules.items[i];
+		if (rule->len == node->len || (rule->recurse && rule->len < node->len))
+		{
+			if (strncmp(rule->prefix, node->path, rule->len) == 0)
+			{
+				active[numactive++] = rule;
+				descend = descend || rule->recurse;
+			}
+		}
+	}
+
+	memset(&e, 0, sizeof(e));
+	if (w->ignorefile)
+		walk_readignores(w, node);
+
+#if PLATFORM_WINDOWS
+	search = (char*)malloc(node->len + 2);
+	strcpy(search, node->path);
+	strcat(search, "*");
+	handle = FindFirstFile(search, &entry);
+	free(search);
+
+	if (handle != INVALID_HANDLE_VALUE)
+	{
+		do
+		{
+			if (entry.cFileName[0] == '.')
+				continue;
+			e.name = entry.cFileName;
+			e.kind = (entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? KIND_DIR : KIND_FILE;
+			walk_entry(w, node, &e, active, numactive, descend, dirs);
+		}
+		while (FindNextFile(handle, &entry));
+		FindClose(handle);
+	}
+#else
+	/* with the listing cache on, a directory which hasn't changed isn't opened */
+	if (w->cwd)
+	{
+		key = walk_cachekey(w, node);
+		if (walk_stat(node, &info) == 0)
+		{
+			cached = globcache_find(key, (long)info.st_mtime, (long)MTIME_NSEC(info));
+		}
+		else
+		{
+			free(key);
+			key = NULL;
+		}
+	}
+
+	if (cached)
+	{
+		if (!walk_isloop(node, &info))
+		{
+			const char* name = cached->names;
+			for (i = 0; i < cached->count; ++i)
+			{
+				e.kind = name[0] - '0';
+				e.name = name + 1;
+				walk_entry(w, node, &e, active, numactive, descend, dirs);
+				name += strlen(name) + 1;
+			}
+		}
+	}
+	else if ((dir = walk_opendir(node)) != NULL)
+	{
+		GlobListing* listing = NULL;
+		struct stat current;
+
+		/* the time is from before the directory was read; if it changes while
+		   I'm reading, the listing won't be used */
+		fstat(dirfd(dir), &current);
+		if (!walk_isloop(node, &current))
+		{
+			if (key)
+				listing = globcache_new(key, (long)info.st_mtime, (long)MTIME_NSEC(info));
+
+			e.dir = dir;
+			while ((e.dirent = readdir(dir)) != NULL)
+			{
+				const char* name = e.dirent->d_name;
+				if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0')))
+					continue;
+				e.name = name;
+				e.kind = 0;
+				walk_entry(w, node, &e, active, numactive, descend, dirs);
+				if (listing)
+					globcache_add(listing, name, entry_kind(&e));
+			}
+
+			if (listing)
+				globcache_store(listing);
+		}
+
+		closedir(dir);
+	}
+
+	free(key);
+#endif
+
+	if (active != stackrules)
+		free(active);
+}
+
+
+
+/*
+ * Read one directory, then queue up its subdirectories for the workers.
+ */
+static void walk_node(Walk* w, int id, WalkNode* node)
+{
+	NameList dirs;
+	size_t i;
+
+	memset(&dirs, 0, sizeof(dirs));
+	walk_read(w, node, &dirs);
+	names_sort(&node->matches);
+	names_sort(&dirs);
+
+	if (dirs.count > 0)
+	{
+		node->children = (WalkNode**)malloc(dirs.count * sizeof(WalkNode*));
+		node->numchildren = dirs.count;
+		for (i = 0; i < dirs.count; ++i)
+		{
+			node->children[i] = node_child(node, dirs.items[i]);
+		}
+
+		/* push in reverse, so my own queue pops them in order */
+		for (i = dirs.count; i > 0; --i)
+		{
+			walk_push(w, id, node->children[i - 1]);
+		}
+	}
+
+	names_free(&dirs);
+}
+
+
+static void walk_work(Walk* w, int id)
+{
+	WalkNode* node;
+	while ((node = walk_next(w, id)) != NULL)
+	{
+		walk_node(w, id, node);
+		walk_finish(w);
+	}
+}
+
+
+#if !PLATFORM_WINDOWS
+static void* walk_thread(void* data)
+{
+	WalkWorker* worker = (WalkWorker*)data;
+	walk_work(worker->walk, worker->id);
+	return NULL;
+}
+#endif
+
+
+
+/*
+ * Copy the results into the Lua table in pre-order: the matches from a
+ * directory, then each of its subdirectories in turn. If a table for the
+ * mask numbers is given, each match's is stored at the same position.
+ * Frees the tree.
+ */
+static int walk_emit(lua_State* L, int result, int masks, int count, WalkNode* node)
+{
+	size_t i;
+	for (i = 0; i < node->matches.count; ++i)
+	{
+		lua_pushstring(L, node->path);
+		lua_pushstring(L, node->matches.items[i]);
+		lua_concat(L, 2);
+		lua_rawseti(L, result, ++count);
+		if (masks)
+		{
+			lua_pushinteger(L, names_gettag(node->matches.items[i]));
+			lua_rawseti(L, masks, count);
+		}
+	}
+
+	for (i = 0; i < node->numchildren; ++i)
+	{
+		count = walk_emit(L, result, masks, count, node->children[i]);
+	}
+
+	names_free(&node->matches);
+	rules_free(&node->ignores);
+	free(node->children);
+	free(node->path);
+	free(node);
+	return count;
+}
+
+
+
+/*
+ * Figure out how many threads to use for a recursive walk, from the
+ * --glob-threads option if set, otherwise one per processor, up to
+ * DEFAULT_THREADS.
+ */
+static int walk_numthreads(lua_State* L)
+{
+	int n = 0;
+
+	lua_getglobal(L, "_OPTIONS");
+	if (lua_istable(L, -1))
+	{
+		lua_getfield(L, -1, "glob-threads");
+		if (lua_isstring(L, -1))
+			n = atoi(lua_tostring(L, -1));
+		lua_pop(L, 1);
+	}
+	lua_pop(L, 1);
+
+#if PLATFORM_WINDOWS
+	n = 1;
+#else
+	if (n <= 0)
+	{
+		n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+		if (n > DEFAULT_THREADS)
+			n = DEFAULT_THREADS;
+	}
+#endif
+
+	if (n < 1) n = 1;
+	if (n > MAX_WALK_THREADS) n = MAX_WALK_THREADS;
+	return n;
+}
+
+
+
+/*
+ * Returns true if a walk of a recursive rule's directory will reach every
+ * path under another rule's prefix. The prefix must start with the same
+ * text, and the rest of it must name real subdirectories: a "." or ".."
+ * component, or an absolute path under an empty root, is never reached.
+ */
+static int prefix_isunder(const MatchRule* root, const MatchRule* rule)
+{
+	const char* ch;
+	const char* part;
+
+	if (root->len >= rule->len || strncmp(root->prefix, rule->prefix, root->len) != 0)
+		return 0;
+
+	part = rule->prefix + root->len;
+	if (root->len == 0 && (part[0] == '/' || part[0] == '\\' || (part[0] != '\0' && part[1] == ':')))
+		return 0;
+
+	for (ch = part; ; ++ch)
+	{
+		if (*ch == '/' || *ch == '\\' || *ch == '\0')
+		{
+			size_t n = ch - part;
+			if ((n == 1 && part[0] == '.') || (n == 2 && part[0] == '.' && part[1] == '.'))
+				return 0;
+			if (*ch == '\0')
+				return 1;
+			part = ch + 1;
+		}
+	}
+}
+
+
+
+/**
+ * Append all of the files (or directories) matching a set of masks to a
+ * result table, walking each directory only once. Masks may be a single
+ * string or a list; brace alternatives are expanded. Entries matching any
+ * of the optional exclusion patterns are skipped, and excluded directories
+ * are not searched. If an ignore file name (like ".gitignore") is given,
+ * that file is read from each directory as it is visited and its patterns
+ * are applied to everything below it. An entry is listed once for each
+ * mask it matches; if a table is given for the mask numbers, it receives
+ * the number of the mask for each match.
+ *
+ *   os.matchwalk(result, masks, wantfiles, excludes, ignorefile, masknumbers)
+ */
+int os_matchwalk(lua_State* L)
+{
+	Walk w;
+	WalkNode** roots;
+	size_t numroots = 0;
+	size_t i, j;
+	int count, recurse = 0;
+
+	luaL_checktype(L, 1, LUA_TTABLE);
+
+	memset(&w, 0, sizeof(w));
+	w.wantfiles = lua_toboolean(L, 3);
+	add_masks(L, 2, &w.rules, add_include);
+	add_masks(L, 4, &w.excludes, add_exclude);
+	w.ignorefile = lua_tostring(L, 5);
+
+#if !PLATFORM_WINDOWS
+	/* the listing cache needs absolute paths */
+	if (globcache_enabled())
+	{
+		const char* cwd = do_getcwd();
+		if (cwd != NULL)
+		{
+			w.cwd = (char*)malloc(strlen(cwd) + 1);
+			strcpy(w.cwd, cwd);
+		}
+	}
+#endif
+
+	/* each distinct prefix not already under a recursive rule needs a walk */
+	roots = (WalkNode**)malloc((w.rules.count + 1) * sizeof(WalkNode*));
+	for (i = 0; i < w.rules.count; ++i)
+	{
+		MatchRule* rule = &w.rules.items[i];
+		int covered = 0;
+
+		for (j = 0; j < w.rules.count && !covered; ++j)
+		{
+			MatchRule* other = &w.rules.items[j];
+			if (other->recurse && prefix_isunder(other, rule))
+				covered = 1;
+		}
+		for (j = 0; j < numroots && !covered; ++j)
+		{
+			if (strcmp(roots[j]->path, rule->prefix) == 0)
+				covered = 1;
+		}
+
+		if (!covered)
+			roots[numroots++] = node_new(NULL, rule->prefix, rule->len);
+		recurse = recurse || rule->recurse;
+	}
+
+	w.numworkers = (recurse) ? walk_numthreads(L) : 1;
+	w.queues = (WalkQueue*)calloc(w.numworkers, sizeof(WalkQueue));
+
+#if PLATFORM_WINDOWS
+	for (i = numroots; i > 0; --i)
+		walk_push(&w, 0, roots[i - 1]);
+	walk_work(&w, 0);
+#else
+	pthread_mutex_init(&w.lock, NULL);
+	pthread_cond_init(&w.wake, NULL);
+	for (i = 0; i < (size_t)w.numworkers; ++i)
+		pthread_mutex_init(&w.queues[i].lock, NULL);
+
+	/* read the top directories before deciding whether threads are worthwhile */
+	for (i = 0; i < numroots; ++i)
+	{
+		walk_push(&w, 0, roots[i]);
+		walk_node(&w, 0, walk_take(&w, 0));
+		walk_finish(&w);
+	}
+
+	if (w.pending > 1 && w.numworkers > 1)
+	{
+		pthread_t threads[MAX_WALK_THREADS];
+		WalkWorker workers[MAX_WALK_THREADS];
+		int numthreads = 0;
+
+		for (i = 1; i < (size_t)w.numworkers; ++i)
+		{
+			workers[i].walk = &w;
+			workers[i].id   = (int)i;
+			if (pthread_create(&threads[numthreads], NULL, walk_thread, &workers[i]) == 0)
+				numthreads++;
+		}
+
+		walk_work(&w, 0);
+		for (i = 0; i < (size_t)numthreads; ++i)
+			pthread_join(threads[i], NULL);
+	}
+	else
+	{
+		walk_work(&w, 0);
+	}
+
+	for (i = 0; i < (size_t)w.numworkers; ++i)
+		pthread_mutex_destroy(&w.queues[i].lock);
+	pthread_cond_destroy(&w.wake);
+	pthread_mutex_destroy(&w.lock);
+#endif
+
+	count = luaL_getn(L, 1);
+	for (i = 0; i < numroots; ++i)
+		count = walk_emit(L, 1, lua_istable(L, 6) ? 6 : 0, count, roots[i]);
+
+	for (i = 0; i < (size_t)w.numworkers; ++i)
+		free(w.queues[i].items);
+	free(w.queues);
+	free(roots);
+	rules_free(&w.rules);
+	rules_free(&w.excludes);
+	free(w.cwd);
+	return 0;
+}
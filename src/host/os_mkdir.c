@@ -19,6 +19,11 @@ int os_mkdir(lua_State* L)
 	z = (mkdir(path, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH) == 0);
 #endif
 
+	if (z)
+		do_remember(path, STAT_DIR);
+	else
+		do_forget(path);
+
 	if (!z)
 	{
 		lua_pushnil(L);
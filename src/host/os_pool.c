@@ -0,0 +1,211 @@
+/**
+ * \file   os_pool.c
+ * \brief  A pooled memory allocator for the Lua state.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ *
+ * \note Building the configurations creates huge numbers of small tables and
+ *       strings, most of which live until Premake exits. Small blocks are cut
+ *       from large chunks, and freed blocks are kept on a list for their size
+ *       to be handed out again; they are only returned to the system when the
+ *       pool is destroyed. Larger blocks go straight to the C library.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "premake.h"
+
+
+#define POOL_GRANULE     (8)
+#define POOL_MAX_SMALL   (256)
+#define POOL_CLASSES     (POOL_MAX_SMALL / POOL_GRANULE)
+#define POOL_CHUNK_SIZE  (64 * 1024)
+
+
+typedef struct struct_PoolChunk
+{
+	struct struct_PoolChunk* next;
+	double align;
+} PoolChunk;
+
+
+typedef struct struct_Pool
+{
+	void*      free[POOL_CLASSES];
+	PoolChunk* chunks;
+	char*      next;
+	char*      end;
+	PoolStats  stats;
+} Pool;
+
+
+static Pool pool;
+
+
+
+/* size classes are numbered from zero, for blocks of 1 to POOL_GRANULE bytes */
+#define size_class(n)   (((n) - 1) / POOL_GRANULE)
+
+
+static void* small_alloc(size_t nsize)
+{
+	int sc = size_class(nsize);
+	size_t size = (sc + 1) * POOL_GRANULE;
+	void* block = pool.free[sc];
+
+	if (block)
+	{
+		pool.free[sc] = *(void**)block;
+		pool.stats.reused++;
+		return block;
+	}
+
+	if (pool.next + size > pool.end)
+	{
+		PoolChunk* chunk = (PoolChunk*)malloc(sizeof(PoolChunk) + POOL_CHUNK_SIZE);
+		if (!chunk)
+			return NULL;
+		chunk->next = pool.chunks;
+		pool.chunks = chunk;
+		pool.next = (char*)(chunk + 1);
+		pool.end = pool.next + POOL_CHUNK_SIZE;
+		pool.stats.chunks++;
+	}
+
+	block = pool.next;
+	pool.next += size;
+	return block;
+}
+
+
+static void small_free(void* block, size_t osize)
+{
+	int sc = size_class(osize);
+	*(void**)block = pool.free[sc];
+	pool.free[sc] = block;
+}
+
+
+
+/*
+ * The allocator installed with lua_newstate(). Lua always passes the old
+ * size of a block, which is what lets the small blocks go without headers.
+ */
+void* pool_alloc(void* ud, void* ptr, size_t osize, size_t nsize)
+{
+	void* block;
+	(void)ud;
+
+	if (nsize == 0)
+	{
+		if (ptr)
+		{
+			pool.stats.frees++;
+			pool.stats.bytes -= osize;
+			if (osize <= POOL_MAX_SMALL)
+				small_free(ptr, osize);
+			else
+				free(ptr);
+		}
+		return NULL;
+	}
+
+	if (ptr == NULL)
+		pool.stats.allocs++;
+	else
+		pool.stats.reallocs++;
+
+	if (ptr && osize > POOL_MAX_SMALL && nsize > POOL_MAX_SMALL)
+	{
+		/* large to large */
+		block = realloc(ptr, nsize);
+	}
+	else if (ptr && size_class(osize) == size_class(nsize) && nsize <= POOL_MAX_SMALL)
+	{
+		/* still fits the same small block */
+		block = ptr;
+	}
+	else
+	{
+		block = (nsize <= POOL_MAX_SMALL) ? small_alloc(nsize) : malloc(nsize);
+		if (block && ptr)
+		{
+			memcpy(block, ptr, (osize < nsize) ? osize : nsize);
+			if (osize <= POOL_MAX_SMALL)
+				small_free(ptr, osize);
+			else
+				free(ptr);
+		}
+	}
+
+	/* Lua assumes shrinking never fails, so keep the old block; it is at
+	   least as big as the new size, and a large block freed later as a small
+	   one just joins that size's list, where it can still be reused */
+	if (!block && ptr && nsize <= osize)
+		block = ptr;
+
+	if (block)
+	{
+		pool.stats.bytes += nsize - ((ptr) ? osize : 0);
+		if (pool.stats.bytes > pool.stats.peak)
+			pool.stats.peak = pool.stats.bytes;
+		if (pool.stats.bytes > pool.stats.peaksince)
+			pool.stats.peaksince = pool.stats.bytes;
+	}
+	return block;
+}
+
+
+/*
+ * Returns the chunks to the system; only call after the state is closed.
+ */
+void pool_destroy()
+{
+	while (pool.chunks)
+	{
+		PoolChunk* next = pool.chunks->next;
+		free(pool.chunks);
+		pool.chunks = next;
+	}
+	memset(&pool, 0, sizeof(pool));
+}
+
+
+const PoolStats* pool_getstats()
+{
+	return &pool.stats;
+}
+
+
+
+/**
+ * Returns a table of the allocator's counters: allocs, reallocs, frees, and
+ * reused (small blocks handed out again), the number of chunks, and the
+ * bytes currently and at most in use. The peaksince counter is the most in
+ * use since a call which passed true, which then starts it over.
+ *
+ *   os.allocstats([restart])
+ */
+int os_allocstats(lua_State* L)
+{
+	const PoolStats* stats = pool_getstats();
+	lua_newtable(L);
+	lua_pushnumber(L, (lua_Number)stats->allocs);
+	lua_setfield(L, -2, "allocs");
+	lua_pushnumber(L, (lua_Number)stats->reallocs);
+	lua_setfield(L, -2, "reallocs");
+	lua_pushnumber(L, (lua_Number)stats->frees);
+	lua_setfield(L, -2, "frees");
+	lua_pushnumber(L, (lua_Number)stats->reused);
+	lua_setfield(L, -2, "reused");
+	lua_pushnumber(L, (lua_Number)stats->chunks);
+	lua_setfield(L, -2, "chunks");
+	lua_pushnumber(L, (lua_Number)stats->bytes);
+	lua_setfield(L, -2, "bytes");
+	lua_pushnumber(L, (lua_Number)stats->peak);
+	lua_setfield(L, -2, "peak");
+	lua_pushnumber(L, (lua_Number)stats->peaksince);
+	lua_setfield(L, -2, "peaksince");
+	if (lua_toboolean(L, 1))
+		pool.stats.peaksince = pool.stats.bytes;
+	return 1;
+}
@@ -0,0 +1,33 @@
+/**
+ * \file   os_remove.c
+ * \brief  Remove a file, keeping the file system cache up to date.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include "premake.h"
+
+
+int os_remove(lua_State* L)
+{
+	const char* filename = luaL_checkstring(L, 1);
+	int z = (remove(filename) == 0);
+	int err = errno;
+
+	do_forget(filename);
+
+	if (!z)
+	{
+		lua_pushnil(L);
+		lua_pushfstring(L, "%s: %s", filename, strerror(err));
+		lua_pushinteger(L, err);
+		return 3;
+	}
+	else
+	{
+		lua_pushboolean(L, 1);
+		return 1;
+	}
+}
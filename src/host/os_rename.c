@@ -0,0 +1,38 @@
+/**
+ * \file   os_rename.c
+ * \brief  Rename a file, keeping the file system cache up to date.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include "premake.h"
+
+
+int os_rename(lua_State* L)
+{
+	const char* oldname = luaL_checkstring(L, 1);
+	const char* newname = luaL_checkstring(L, 2);
+	int z = (rename(oldname, newname) == 0);
+	int err = errno;
+
+	/* if a whole directory moved, anything below either name is stale */
+	do_forget(oldname);
+	do_forget(newname);
+	if (do_stat(newname) == STAT_DIR)
+		do_forget(NULL);
+
+	if (!z)
+	{
+		lua_pushnil(L);
+		lua_pushfstring(L, "%s: %s", oldname, strerror(err));
+		lua_pushinteger(L, err);
+		return 3;
+	}
+	else
+	{
+		lua_pushboolean(L, 1);
+		return 1;
+	}
+}
@@ -19,6 +19,9 @@ int os_rmdir(lua_State* L)
 	z = rmdir(path);
 #endif
 
+	/* anything below it is gone too */
+	do_forget(NULL);
+
 	if (!z)
 	{
 		lua_pushnil(L);
@@ -0,0 +1,266 @@
+/**
+ * \file   os_statcache.c
+ * \brief  Remembers the working directory and what exists on the file system.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ *
+ * \note Premake checks for the same files and directories over and over, and
+ *       looks up the working directory for every relative path it makes
+ *       absolute. The answers are remembered here until Premake changes the
+ *       file system itself: the functions which create, remove, or rename
+ *       files call do_forget() or do_remember() to keep the cache honest.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <sys/stat.h>
+#include "premake.h"
+
+
+#define CACHE_BUCKETS   (1024)
+
+
+typedef struct struct_StatEntry
+{
+	struct struct_StatEntry* next;
+	int   kind;
+	char  path[1];
+} StatEntry;
+
+
+static StatEntry* buckets[CACHE_BUCKETS];
+static char* cwd = NULL;
+
+
+
+/*
+ * Returns the current working directory, with platform-neutral separators.
+ */
+const char* do_getcwd()
+{
+	if (!cwd)
+	{
+		char buffer[0x4000];
+		char* ch;
+		int result;
+
+#if PLATFORM_WINDOWS
+		result = (GetCurrentDirectory(0x4000, buffer) != 0);
+#else
+		result = (getcwd(buffer, 0x4000) != 0);
+#endif
+
+		if (!result)
+			return NULL;
+
+		for (ch = buffer; *ch != '\0'; ++ch)
+		{
+			if (*ch == '\\') *ch = '/';
+		}
+
+		cwd = (char*)malloc(strlen(buffer) + 1);
+		strcpy(cwd, buffer);
+	}
+	return cwd;
+}
+
+
+/*
+ * Called when the working directory changes.
+ */
+void do_resetcwd()
+{
+	free(cwd);
+	cwd = NULL;
+}
+
+
+
+/*
+ * Entries are keyed on the absolute path, with the separators, "." and ".."
+ * parts, and (on Windows) the case normalized, so that the same path spelled
+ * two different ways is still forgotten when it changes.
+ */
+static char* make_key(const char* path)
+{
+	const char* base = "";
+	const char* src;
+	char* key;
+	char* dst;
+	char* root;
+
+	if (path[0] != '/' && path[0] != '\\' && !(path[0] != '\0' && path[1] == ':'))
+	{
+		base = do_getcwd();
+		if (!base) base = "";
+	}
+
+	key = (char*)malloc(strlen(base) + strlen(path) + 3);
+	strcpy(key, base);
+	strcat(key, "/");
+	strcat(key, path);
+
+	/* keep any drive letter out of the way of the ".." processing */
+	root = key;
+	if (key[0] != '\0' && key[1] == ':')
+		root += 2;
+
+	dst = root;
+	for (src = root; *src; )
+	{
+		const char* end;
+		size_t n;
+
+		while (*src == '/' || *src == '\\') ++src;
+		for (end = src; *end && *end != '/' && *end != '\\'; ++end);
+		n = end - src;
+
+		if (n == 0 || (n == 1 && src[0] == '.'))
+		{
+			/* nothing to add */
+		}
+		else if (n == 2 && src[0] == '.' && src[1] == '.')
+		{
+			while (dst > root && *(--dst) != '/');
+		}
+		else
+		{
+			*dst++ = '/';
+			memmove(dst, src, n);
+			dst += n;
+		}
+		src = end;
+	}
+	if (dst == root)
+		*dst++ = '/';
+	*dst = '\0';
+
+#if PLATFORM_WINDOWS
+	for (dst = key; *dst; ++dst)
+		*dst = (char)tolower((unsigned char)*dst);
+#endif
+	return key;
+}
+
+
+static unsigned long hash_key(const char* key)
+{
+	unsigned long hash = 2166136261UL;
+	while (*key)
+	{
+		hash = (hash ^ (unsigned char)*key++) * 16777619UL;
+	}
+	return hash;
+}
+
+
+static StatEntry** find_entry(const char* key)
+{
+	StatEntry** entry = &buckets[hash_key(key) % CACHE_BUCKETS];
+	while (*entry && strcmp((*entry)->path, key) != 0)
+	{
+		entry = &(*entry)->next;
+	}
+	return entry;
+}
+
+
+
+/*
+ * Returns STAT_NONE, STAT_FILE, or STAT_DIR for a path; anything which
+ * exists and isn't a directory counts as a file.
+ */
+int do_stat(const char* path)
+{
+	struct stat buf;
+	char* key;
+	StatEntry** entry;
+
+	if (path[0] == '\0')
+		return STAT_NONE;
+
+	key = make_key(path);
+	entry = find_entry(key);
+	if (!*entry)
+	{
+		int kind = STAT_NONE;
+		if (stat(path, &buf) == 0)
+			kind = (buf.st_mode & S_IFDIR) ? STAT_DIR : STAT_FILE;
+
+		*entry = (StatEntry*)malloc(sizeof(StatEntry) + strlen(key));
+		(*entry)->next = NULL;
+		(*entry)->kind = kind;
+		strcpy((*entry)->path, key);
+	}
+
+	free(key);
+	return (*entry)->kind;
+}
+
+
+/*
+ * Record a change made by Premake.
+ */
+void do_remember(const char* path, int kind)
+{
+	char* key = make_key(path);
+	StatEntry** entry = find_entry(key);
+
+	if (!*entry)
+	{
+		*entry = (StatEntry*)malloc(sizeof(StatEntry) + strlen(key));
+		(*entry)->next = NULL;
+		strcpy((*entry)->path, key);
+	}
+	(*entry)->kind = kind;
+
+	free(key);
+}
+
+
+/*
+ * Forget what is known about a path; with no path, forget everything.
+ */
+void do_forget(const char* path)
+{
+	if (path)
+	{
+		char* key = make_key(path);
+		StatEntry** entry = find_entry(key);
+		if (*entry)
+		{
+			StatEntry* next = (*entry)->next;
+			free(*entry);
+			*entry = next;
+		}
+		free(key);
+	}
+	else
+	{
+		int i;
+		for (i = 0; i < CACHE_BUCKETS; ++i)
+		{
+			while (buckets[i])
+			{
+				StatEntry* next = buckets[i]->next;
+				free(buckets[i]);
+				buckets[i] = next;
+			}
+		}
+	}
+}
+
+
+
+/**
+ * Discard anything remembered about a path, or with no arguments about any
+ * path. Call this after changing the file system outside of Premake's own
+ * functions, for instance with a shell command.
+ *
+ *   os.flushcache([path])
+ */
+int os_flushcache(lua_State* L)
+{
+	do_forget(luaL_optstring(L, 1, NULL));
+	return 0;
+}
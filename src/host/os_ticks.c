@@ -0,0 +1,46 @@
+/**
+ * \file   os_ticks.c
+ * \brief  A high resolution timer, for tracing and timing the scripts.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ */
+
+#include "premake.h"
+
+#if PLATFORM_WINDOWS
+/* QueryPerformanceCounter() comes in through windows.h */
+#elif PLATFORM_MACOSX
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
+
+
+/**
+ * Returns the number of microseconds since some fixed point, such as when
+ * the system was started. Only the difference between two calls means
+ * anything.
+ *
+ *   os.ticks()
+ */
+int os_ticks(lua_State* L)
+{
+	double ticks;
+
+#if PLATFORM_WINDOWS
+	LARGE_INTEGER count, frequency;
+	QueryPerformanceCounter(&count);
+	QueryPerformanceFrequency(&frequency);
+	ticks = (double)count.QuadPart * 1000000.0 / (double)frequency.QuadPart;
+#elif PLATFORM_MACOSX
+	mach_timebase_info_data_t timebase;
+	mach_timebase_info(&timebase);
+	ticks = (double)mach_absolute_time() * timebase.numer / timebase.denom / 1000.0;
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	ticks = (double)ts.tv_sec * 1000000.0 + (double)ts.tv_nsec / 1000.0;
+#endif
+
+	lua_pushnumber(L, ticks);
+	return 1;
+}
@@ -4,14 +4,27 @@
  * \author Copyright (c) 2002-2008 Jason Perkins and the Premake project
  */
 
+#include <stdlib.h>
+#include <string.h>
 #include "premake.h"
 
 
-int os_uuid(lua_State* L)
-{
-	unsigned char bytes[16];
-	char uuid[38];
+/*
+ * Name-based UUIDs are made in Premake's own namespace, so they can't clash
+ * with those made the same way by other tools. Never change this, or every
+ * generated project will get a new ID.
+ */
+static const unsigned char premake_namespace[16] = {
+	0x5E, 0x2B, 0x97, 0x46, 0x0C, 0x1D, 0x4F, 0x3A,
+	0x9B, 0x61, 0x7D, 0x24, 0xE8, 0x50, 0xA3, 0x1F
+};
+
 
+/*
+ * Fills in 16 random bytes; returns false if no randomness is available.
+ */
+static int random_uuid(unsigned char bytes[16])
+{
 #if PLATFORM_WINDOWS
 
 	static int (__stdcall *CoCreateGuid)(char*) = NULL;
@@ -21,6 +34,7 @@ int os_uuid(lua_State* L)
 		CoCreateGuid = (int(__stdcall*)(char*))GetProcAddress(hOleDll, "CoCreateGuid");
 	}
 	CoCreateGuid((char*)bytes);
+	return 1;
 
 #else
 	int result;
@@ -29,9 +43,51 @@ int os_uuid(lua_State* L)
 	FILE* rnd = fopen("/dev/urandom", "rb");
 	result = fread(bytes, 16, 1, rnd);
 	fclose(rnd);
-	if (!result)
-		return 0;
+	return result;
 #endif
+}
+
+
+/*
+ * Fills in a version 5 UUID, the SHA-1 digest of the namespace and name.
+ */
+static void named_uuid(unsigned char bytes[16], const char* name, size_t length)
+{
+	unsigned char digest[20];
+	unsigned char* buffer = (unsigned char*)malloc(length + 16);
+	memcpy(buffer, premake_namespace, 16);
+	memcpy(buffer + 16, name, length);
+	do_sha1(buffer, length + 16, digest);
+	free(buffer);
+
+	memcpy(bytes, digest, 16);
+	bytes[6] = (unsigned char)((bytes[6] & 0x0F) | 0x50);
+	bytes[8] = (unsigned char)((bytes[8] & 0x3F) | 0x80);
+}
+
+
+
+/*
+ * Returns a new UUID. Given a name, the UUID is derived from it, and is the
+ * same every time; otherwise it is random.
+ *
+ *   os.uuid([name])
+ */
+int os_uuid(lua_State* L)
+{
+	unsigned char bytes[16];
+	char uuid[38];
+
+	if (!lua_isnoneornil(L, 1))
+	{
+		size_t length;
+		const char* name = luaL_checklstring(L, 1, &length);
+		named_uuid(bytes, name, length);
+	}
+	else if (!random_uuid(bytes))
+	{
+		return 0;
+	}
 
 	sprintf(uuid, "%02X%02X%02X%02X-%02X%02X-%02X%02X-%02X%02X-%02X%02X%02X%02X%02X%02X",
 		bytes[0], bytes[1], bytes[2], bytes[3],
@@ -0,0 +1,324 @@
+/**
+ * \file   path_dirtree.c
+ * \brief  An interned tree of directories, for fast relative paths.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ *
+ * \note A project's thousands of files share a handful of directories, and
+ *       all of them are made relative to the same few locations. Each unique
+ *       directory is stored once, as a node pointing to its parent, so the
+ *       relative path between two directories is just a walk up to their
+ *       common ancestor, and that result is remembered for the session.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "premake.h"
+
+
+typedef struct struct_DirNode
+{
+	struct struct_DirNode* parent;
+	struct struct_DirNode* next;
+	size_t depth;
+	size_t len;
+	char   path[1];
+} DirNode;
+
+
+typedef struct struct_RelEntry
+{
+	DirNode* from;
+	DirNode* to;
+	DirNode* common;
+	char*    result;
+} RelEntry;
+
+
+static DirNode** nodes = NULL;
+static size_t num_nodes = 0;
+static size_t nodes_size = 0;
+
+static RelEntry* relatives = NULL;
+static size_t num_relatives = 0;
+static size_t relatives_size = 0;
+
+
+
+static unsigned long hash_string(const char* s, size_t len)
+{
+	unsigned long hash = 2166136261UL;
+	while (len-- > 0)
+	{
+		hash = (hash ^ (unsigned char)*s++) * 16777619UL;
+	}
+	return hash;
+}
+
+
+static unsigned long hash_pair(DirNode* from, DirNode* to)
+{
+	unsigned long a = (unsigned long)(size_t)from;
+	unsigned long b = (unsigned long)(size_t)to;
+	return (a * 31) ^ (b * 16777619UL) ^ (b >> 7);
+}
+
+
+
+/*
+ * Returns the node for the first len characters of an absolute path, which
+ * has been checked by dirtree_iscanonical(), creating it and any missing parents.
+ * The root is the part before the first separator: empty, or a drive.
+ */
+static DirNode* intern(const char* path, size_t len)
+{
+	DirNode* node;
+	DirNode* parent = NULL;
+	unsigned long hash = hash_string(path, len);
+	size_t i;
+
+	if (nodes)
+	{
+		for (node = nodes[hash & (nodes_size - 1)]; node; node = node->next)
+		{
+			if (node->len == len && memcmp(node->path, path, len) == 0)
+				return node;
+		}
+	}
+
+	/* find the parent first; the root has no separator */
+	for (i = len; i > 0 && path[i - 1] != '/'; --i);
+	if (i > 0)
+		parent = intern(path, i - 1);
+
+	if ((num_nodes + 1) * 2 > nodes_size)
+	{
+		size_t size = (nodes_size) ? nodes_size * 2 : 256;
+		DirNode** items = (DirNode**)calloc(size, sizeof(DirNode*));
+		for (i = 0; i < nodes_size; ++i)
+		{
+			while (nodes[i])
+			{
+				DirNode* next = nodes[i]->next;
+				unsigned long slot = hash_string(nodes[i]->path, nodes[i]->len) & (size - 1);
+				nodes[i]->next = items[slot];
+				items[slot] = nodes[i];
+				nodes[i] = next;
+			}
+		}
+		free(nodes);
+		nodes = items;
+		nodes_size = size;
+	}
+
+	node = (DirNode*)malloc(sizeof(DirNode) + len);
+	node->parent = parent;
+	node->depth  = (parent) ? parent->depth + 1 : 0;
+	node->len    = len;
+	memcpy(node->path, path, len);
+	node->path[len] = '\0';
+
+	node->next = nodes[hash & (nodes_size - 1)];
+	nodes[hash & (nodes_size - 1)] = node;
+	num_nodes++;
+	return node;
+}
+
+
+/* the last part of a node's path */
+#define node_name(n)   ((n)->path + (n)->parent->len + 1)
+
+
+
+/*
+ * Returns the relative path from one directory to another, and their common
+ * ancestor. The results are remembered.
+ */
+static RelEntry* relative(DirNode* from, DirNode* to)
+{
+	RelEntry* entry;
+	DirNode* a;
+	DirNode* b;
+	DirNode* chain[256];
+	DirNode** down = chain;
+	size_t i, ups = 0, numdown = 0, size;
+	char* ch;
+
+	if (relatives)
+	{
+		i = hash_pair(from, to) & (relatives_size - 1);
+		while (relatives[i].from)
+		{
+			if (relatives[i].from == from && relatives[i].to == to)
+				return &relatives[i];
+			i = (i + 1) & (relatives_size - 1);
+		}
+	}
+
+	/* walk both up to the common ancestor, remembering the way back down */
+	if (to->depth > 256)
+		down = (DirNode**)malloc(to->depth * sizeof(DirNode*));
+	a = from;
+	b = to;
+	while (a->depth > b->depth)
+	{
+		a = a->parent;
+		ups++;
+	}
+	while (b->depth > a->depth)
+	{
+		down[numdown++] = b;
+		b = b->parent;
+	}
+	while (a != b)
+	{
+		a = a->parent;
+		ups++;
+		down[numdown++] = b;
+		b = b->parent;
+	}
+
+	size = ups * 3 + 2;
+	for (i = 0; i < numdown; ++i)
+		size += strlen(node_name(down[i])) + 1;
+
+	entry = (RelEntry*)malloc(sizeof(RelEntry));
+	entry->from   = from;
+	entry->to     = to;
+	entry->common = a;
+	entry->result = ch = (char*)malloc(size);
+	for (i = 0; i < ups; ++i)
+	{
+		strcpy(ch, "../");
+		ch += 3;
+	}
+	while (numdown > 0)
+	{
+		b = down[--numdown];
+		strcpy(ch, node_name(b));
+		ch += strlen(ch);
+		*(ch++) = '/';
+	}
+	if (ch == entry->result)
+		strcpy(ch, "./");
+	else
+		*ch = '\0';
+
+	/* drop the trailing separator */
+	entry->result[strlen(entry->result) - 1] = '\0';
+
+	if (down != chain)
+		free(down);
+
+	/* store it */
+	if ((num_relatives + 1) * 2 > relatives_size)
+	{
+		size_t newsize = (relatives_size) ? relatives_size * 2 : 256;
+		RelEntry* items = (RelEntry*)calloc(newsize, sizeof(RelEntry));
+		for (i = 0; i < relatives_size; ++i)
+		{
+			if (relatives[i].from)
+			{
+				size_t j = hash_pair(relatives[i].from, relatives[i].to) & (newsize - 1);
+				while (items[j].from)
+					j = (j + 1) & (newsize - 1);
+				items[j] = relatives[i];
+			}
+		}
+		free(relatives);
+		relatives = items;
+		relatives_size = newsize;
+	}
+
+	i = hash_pair(from, to) & (relatives_size - 1);
+	while (relatives[i].from)
+		i = (i + 1) & (relatives_size - 1);
+	relatives[i] = *entry;
+	free(entry);
+	num_relatives++;
+	return &relatives[i];
+}
+
+
+
+/*
+ * Returns true if a path is absolute and already in the form that
+ * do_getabsolute() would produce: a root, then one or more non-empty parts,
+ * none of them "." or "..", with no trailing separator.
+ */
+int dirtree_iscanonical(const char* path)
+{
+	const char* ch = path;
+
+	if (ch[0] != '\0' && ch[1] == ':')
+		ch += 2;
+	if (*ch != '/')
+		return 0;
+
+	while (*ch == '/')
+	{
+		const char* part = ++ch;
+		while (*ch && *ch != '/' && *ch != '\\')
+			++ch;
+		if (*ch == '\\')
+			return 0;
+		if (ch == part || (ch - part == 1 && part[0] == '.') || (ch - part == 2 && part[0] == '.' && part[1] == '.'))
+			return 0;
+	}
+
+	return 1;
+}
+
+
+
+/*
+ * Returns the relative path between two canonical, different paths on the
+ * same drive, as a new string which the caller must free. The destination
+ * may be a file, so only its directory is interned.
+ */
+char* dirtree_getrelative(const char* src, const char* dst)
+{
+	DirNode* from;
+	DirNode* dir;
+	RelEntry* rel;
+	const char* name = strrchr(dst, '/') + 1;
+	char* result;
+
+	from = intern(src, strlen(src));
+	dir  = intern(dst, name - dst - 1);
+	rel  = relative(from, dir);
+
+	/* is the destination itself one of the source's parents? */
+	if (rel->common == dir && from != dir)
+	{
+		DirNode* child = from;
+		size_t ups = 0;
+		while (child->parent != dir)
+		{
+			child = child->parent;
+			ups++;
+		}
+		if (ups > 0 && strcmp(node_name(child), name) == 0)
+		{
+			/* one "../" for each step up to that parent, less the last slash */
+			result = (char*)malloc(ups * 3 + 1);
+			strcpy(result, "..");
+			while (--ups > 0)
+				strcat(result, "/..");
+			return result;
+		}
+	}
+
+	if (strcmp(rel->result, ".") == 0)
+	{
+		result = (char*)malloc(strlen(name) + 1);
+		strcpy(result, name);
+	}
+	else
+	{
+		result = (char*)malloc(strlen(rel->result) + strlen(name) + 2);
+		strcpy(result, rel->result);
+		strcat(result, "/");
+		strcat(result, name);
+	}
+	return result;
+}
@@ -0,0 +1,125 @@
+/**
+ * \file   path_getabsolute.c
+ * \brief  Get the absolute file path from a relative path.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "premake.h"
+
+
+/*
+ * Works through the path one part at a time, exactly as the original
+ * script version did, so the results are the same even for odd input like
+ * doubled separators or ".." above the root. The result is built in place;
+ * it can never be longer than the working directory plus the path. Returns
+ * a new string, which the caller must free.
+ */
+char* do_getabsolute(const char* path)
+{
+	const char* cwd = NULL;
+	const char* part;
+	char* result;
+	size_t len = 0;
+	int isnull = 0;
+
+	if (path[0] == '\0')
+		path = ".";
+
+	/* the separators are normalized as the parts are copied */
+	if (!do_isabsolute(path))
+	{
+		cwd = do_getcwd();
+		isnull = (cwd == NULL);
+	}
+	else
+	{
+		isnull = 1;
+	}
+
+	result = (char*)malloc((cwd ? strlen(cwd) : 0) + strlen(path) + 3);
+	if (cwd)
+	{
+		strcpy(result, cwd);
+		len = strlen(result);
+	}
+
+	for (part = path; part; )
+	{
+		const char* end = part;
+		size_t n;
+
+		while (*end && *end != '/' && *end != '\\') ++end;
+		n = end - part;
+
+		if (n == 0 && part == path)
+		{
+			strcpy(result, "/");
+			len = 1;
+			isnull = 0;
+		}
+		else if (n == 2 && part[0] == '.' && part[1] == '.')
+		{
+			/* the parent is everything before the last separator */
+			char* last;
+			result[len] = '\0';
+			last = (isnull) ? NULL : strrchr(result, '/');
+			if (last)
+			{
+				len = (last == result) ? 1 : (size_t)(last - result);
+			}
+			else
+			{
+				strcpy(result, ".");
+				len = 1;
+			}
+			isnull = 0;
+		}
+		else if (!(n == 1 && part[0] == '.'))
+		{
+			/* join the part on, as path.join() would */
+			if (n >= 2 && part[1] == ':')
+			{
+				len = 0;
+			}
+			else
+			{
+				if (isnull || (len == 1 && result[0] == '.'))
+					len = 0;
+				if (len > 0 && result[len - 1] != '/')
+					result[len++] = '/';
+			}
+			memcpy(result + len, part, n);
+			len += n;
+			isnull = 0;
+		}
+
+		part = (*end) ? end + 1 : NULL;
+	}
+
+	result[len] = '\0';
+	if (isnull)
+	{
+		free(result);
+		return NULL;
+	}
+
+	/* if I end up with a trailing slash remove it */
+	if (len > 0 && result[len - 1] == '/')
+		result[len - 1] = '\0';
+
+	return result;
+}
+
+
+int path_getabsolute(lua_State* L)
+{
+	char* result = do_getabsolute(luaL_checkstring(L, 1));
+	if (!result)
+		return 0;
+
+	lua_pushstring(L, result);
+	free(result);
+	return 1;
+}
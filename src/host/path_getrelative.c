@@ -0,0 +1,114 @@
+/**
+ * \file   path_getrelative.c
+ * \brief  Returns the relative path from one location to another.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "premake.h"
+
+
+/*
+ * Returns a new string, which the caller must free.
+ */
+char* do_getrelative(const char* from, const char* to)
+{
+	char* src = do_getabsolute(from);
+	char* dst = do_getabsolute(to);
+	char* result;
+	const char* slash;
+	const char* s;
+	const char* d;
+	size_t srclen, dstlen, ups;
+
+	if (!src || !dst)
+	{
+		free(src);
+		return dst;
+	}
+
+	/* same directory? */
+	if (strcmp(src, dst) == 0)
+	{
+		free(src);
+		free(dst);
+		result = (char*)malloc(2);
+		strcpy(result, ".");
+		return result;
+	}
+
+	/* different drives? Must use absolute path */
+	if ((src[0] != '\0' && src[1] == ':') || (dst[0] != '\0' && dst[1] == ':'))
+	{
+		int srcdrive = (src[0] != '\0' && src[1] == ':') ? src[0] : -1;
+		int dstdrive = (dst[0] != '\0' && dst[1] == ':') ? dst[0] : -1;
+		if (srcdrive != dstdrive)
+		{
+			free(src);
+			return dst;
+		}
+	}
+
+	/* the usual case, two well-formed absolute paths, is looked up on the
+	   shared directory tree; anything odd is worked out the long way */
+	if (dirtree_iscanonical(src) && dirtree_iscanonical(dst))
+	{
+		result = dirtree_getrelative(src, dst);
+		free(src);
+		free(dst);
+		return result;
+	}
+
+	/* trim off the common directories from the front, with a separator
+	   added to the end of each path so the last directory counts too */
+	srclen = strlen(src);
+	dstlen = strlen(dst);
+	src = (char*)realloc(src, srclen + 2);
+	dst = (char*)realloc(dst, dstlen + 2);
+	strcpy(src + srclen++, "/");
+	strcpy(dst + dstlen++, "/");
+
+	s = src;
+	d = dst;
+	while ((slash = strchr(s, '/')) != NULL)
+	{
+		size_t n = slash - s + 1;
+		if (dstlen - (d - dst) < n || strncmp(s, d, n) != 0)
+			break;
+		s += n;
+		d += n;
+	}
+
+	/* back up from dst to get to this common parent */
+	ups = 0;
+	for (slash = s; *slash; ++slash)
+	{
+		if (*slash == '/') ups++;
+	}
+
+	/* tack on the path down to the dst from here, less the trailing slash */
+	result = (char*)malloc(ups * 3 + strlen(d) + 1);
+	result[0] = '\0';
+	while (ups-- > 0)
+		strcat(result, "../");
+	strcat(result, d);
+	if (result[0] != '\0')
+		result[strlen(result) - 1] = '\0';
+
+	free(src);
+	free(dst);
+	return result;
+}
+
+
+int path_getrelative(lua_State* L)
+{
+	char* result = do_getrelative(luaL_checkstring(L, 1), luaL_checkstring(L, 2));
+	if (!result)
+		return 0;
+
+	lua_pushstring(L, result);
+	free(result);
+	return 1;
+}
@@ -10,7 +10,7 @@
 int path_isabsolute(lua_State* L)
 {
 	const char* path = luaL_checkstring(L, 1);
-	if (path[0] == '/' || path[0] == '\\' || (path[0] != '\0' && path[1] == ':')) 
+	if (do_isabsolute(path))
 	{
 		lua_pushboolean(L, 1);
 		return 1;
@@ -20,3 +20,9 @@ int path_isabsolute(lua_State* L)
 		return 0;
 	}
 }
+
+
+int do_isabsolute(const char* path)
+{
+	return (path[0] == '/' || path[0] == '\\' || (path[0] != '\0' && path[1] == ':'));
+}
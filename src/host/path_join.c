@@ -0,0 +1,52 @@
+/**
+ * \file   path_join.c
+ * \brief  Join two pieces of a path together into a single path.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "premake.h"
+
+
+/*
+ * Returns a new string, which the caller must free. A NULL leading part is
+ * treated as an empty string; an absolute trailing part replaces it.
+ */
+char* do_join(const char* leading, const char* trailing)
+{
+	char* result;
+	size_t n;
+
+	if (!leading || (leading[0] == '.' && leading[1] == '\0'))
+		leading = "";
+
+	if (do_isabsolute(trailing))
+		leading = "";
+
+	n = strlen(leading);
+	result = (char*)malloc(n + strlen(trailing) + 2);
+	strcpy(result, leading);
+	if (n > 0 && leading[n - 1] != '/')
+		result[n++] = '/';
+	strcpy(result + n, trailing);
+	return result;
+}
+
+
+int path_join(lua_State* L)
+{
+	const char* leading = luaL_optstring(L, 1, "");
+	char* result;
+
+	if (!lua_toboolean(L, 2))
+	{
+		lua_pushstring(L, leading);
+		return 1;
+	}
+
+	result = do_join(leading, luaL_checkstring(L, 2));
+	lua_pushstring(L, result);
+	free(result);
+	return 1;
+}
@@ -0,0 +1,45 @@
+/**
+ * \file   path_rebase.c
+ * \brief  Makes a path relative to a different location.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "premake.h"
+
+
+/*
+ * Takes a path which is relative to one location and makes it relative
+ * to another location instead.
+ */
+int path_rebase(lua_State* L)
+{
+	const char* oldbase = luaL_optstring(L, 2, "");
+	const char* newbase = luaL_checkstring(L, 3);
+	char* joined;
+	char* absolute;
+	char* result;
+
+	if (lua_toboolean(L, 1))
+	{
+		joined = do_join(oldbase, luaL_checkstring(L, 1));
+	}
+	else
+	{
+		joined = (char*)malloc(strlen(oldbase) + 1);
+		strcpy(joined, oldbase);
+	}
+
+	absolute = do_getabsolute(joined);
+	result = (absolute) ? do_getrelative(newbase, absolute) : NULL;
+	free(joined);
+	free(absolute);
+
+	if (!result)
+		return 0;
+
+	lua_pushstring(L, result);
+	free(result);
+	return 1;
+}
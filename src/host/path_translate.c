@@ -0,0 +1,87 @@
+/**
+ * \file   path_translate.c
+ * \brief  Convert the separators in a path from one form to another.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ */
+
+#include <ctype.h>
+#include <string.h>
+#include "premake.h"
+
+
+/*
+ * The platform-specific separator is the one for the target OS, which may
+ * have been changed with --os, rather than the one Premake is running on.
+ */
+static const char* default_separator(lua_State* L)
+{
+	const char* os = NULL;
+	const char* windows = "windows";
+	size_t i;
+
+	lua_getglobal(L, "_OPTIONS");
+	if (lua_istable(L, -1))
+	{
+		lua_getfield(L, -1, "os");
+		os = lua_tostring(L, -1);
+		lua_pop(L, 1);
+	}
+	lua_pop(L, 1);
+
+	if (!os)
+	{
+		lua_getglobal(L, "_OS");
+		os = lua_tostring(L, -1);
+		lua_pop(L, 1);
+	}
+
+	if (!os || strlen(os) != strlen(windows))
+		return "/";
+	for (i = 0; os[i] != '\0'; ++i)
+	{
+		if (tolower((unsigned char)os[i]) != windows[i])
+			return "/";
+	}
+	return "\\";
+}
+
+
+static void push_translated(lua_State* L, const char* path, const char* sep)
+{
+	luaL_Buffer b;
+	luaL_buffinit(L, &b);
+	for (; *path != '\0'; ++path)
+	{
+		if (*path == '/' || *path == '\\')
+			luaL_addstring(&b, sep);
+		else
+			luaL_addchar(&b, *path);
+	}
+	luaL_pushresult(&b);
+}
+
+
+int path_translate(lua_State* L)
+{
+	/* the items of a list always get the default separator */
+	if (lua_istable(L, 1))
+	{
+		const char* sep = default_separator(L);
+		int i;
+		lua_newtable(L);
+		for (i = 1; ; ++i)
+		{
+			lua_rawgeti(L, 1, i);
+			if (lua_isnil(L, -1))
+				break;
+			push_translated(L, luaL_checkstring(L, -1), sep);
+			lua_rawseti(L, -3, i);
+			lua_pop(L, 1);
+		}
+		lua_pop(L, 1);
+		return 1;
+	}
+
+	push_translated(L, luaL_checkstring(L, 1), luaL_optstring(L, 2, default_separator(L)));
+	return 1;
+}
@@ -17,37 +17,66 @@
 static int process_arguments(lua_State* L, int argc, const char** argv);
 static int process_option(lua_State* L, const char* arg);
 static int load_builtin_scripts(lua_State* L);
+static int panic(lua_State* L);
 
 
 /* A search path for script files */
 static const char* scripts_path = NULL;
 
+/* Set by the /allocstats, /fast-exit, and /profile options */
+static int show_allocstats = 0;
+static int fast_exit = 0;
+static const char* profile_file = NULL;
+
 
 /* precompiled bytecode buffer; in bytecode.c */
 extern const char* builtin_scripts[];
 
+/* scripts loaded on demand, as name and source pairs; in scripts.c */
+extern const char* builtin_modules[];
+
+/* precompiled bytecode for all of the above, if it was embedded; in scripts.c */
+extern const char builtin_bytecode_header[];
+extern const BuiltinChunk builtin_bytecode[];
+
 
 /* Built-in functions */
 static const luaL_Reg path_functions[] = {
-	{ "isabsolute",  path_isabsolute },
+	{ "getabsolute", path_getabsolute },
+	{ "getrelative", path_getrelative },
+	{ "isabsolute",  path_isabsolute  },
+	{ "join",        path_join        },
+	{ "rebase",      path_rebase      },
+	{ "translate",   path_translate   },
 	{ NULL, NULL }
 };
 
 static const luaL_Reg os_functions[] = {
+	{ "allocstats",  os_allocstats  },
 	{ "chdir",       os_chdir       },
 	{ "copyfile",    os_copyfile    },
+	{ "flushcache",  os_flushcache  },
+	{ "fork",        os_fork        },
 	{ "isdir",       os_isdir       },
 	{ "getcwd",      os_getcwd      },
 	{ "isfile",      os_isfile      },
+	{ "loadglobcache", os_loadglobcache },
+	{ "loadscript",  os_loadscript  },
 	{ "matchdone",   os_matchdone   },
 	{ "matchisfile", os_matchisfile },
 	{ "matchname",   os_matchname   },
 	{ "matchnext",   os_matchnext   },
 	{ "matchstart",  os_matchstart  },
+	{ "matchwalk",   os_matchwalk   },
 	{ "mkdir",       os_mkdir       },
 	{ "pathsearch",  os_pathsearch  },
+	{ "remove",      os_remove      },
+	{ "rename",      os_rename      },
 	{ "rmdir",       os_rmdir       },
+	{ "saveglobcache", os_saveglobcache },
+	{ "ticks",       os_ticks       },
 	{ "uuid",        os_uuid        },
+	{ "waitpid",     os_waitpid     },
 	{ NULL, NULL }
 };
 
@@ -67,7 +96,13 @@ int main(int argc, const char** argv)
 	int z = OKAY;
 
 	/* prepare Lua for use */
-	L = lua_open();
+	L = lua_newstate(pool_alloc, NULL);
+	if (L == NULL)
+	{
+		printf(ERROR_MESSAGE, "Unable to create the Lua state");
+		return !OKAY;
+	}
+	lua_atpanic(L, panic);
 	luaL_openlibs(L);
 	luaL_register(L, "path",   path_functions);
 	luaL_register(L, "os",     os_functions);
@@ -90,16 +125,49 @@ int main(int argc, const char** argv)
 	/* Parse the command line arguments */
 	if (z == OKAY)  z = process_arguments(L, argc, argv);
 
-	/* Run the built-in Premake scripts */
+	/* Run the built-in Premake scripts, sampling them if asked */
+	if (z == OKAY && profile_file)  profile_start(L, profile_file);
 	if (z == OKAY)  z = load_builtin_scripts(L);
+	if (profile_file && profile_stop(L) != OKAY)  z = !OKAY;
+
+	if (show_allocstats)
+	{
+		const PoolStats* stats = pool_getstats();
+		printf("Allocations: %lu allocs, %lu reallocs, %lu frees (%lu reused)\n",
+			(unsigned long)stats->allocs, (unsigned long)stats->reallocs,
+			(unsigned long)stats->frees, (unsigned long)stats->reused);
+		printf("Memory: %lu KB in use, %lu KB peak, %lu pool chunks\n",
+			(unsigned long)(stats->bytes / 1024), (unsigned long)(stats->peak / 1024),
+			(unsigned long)stats->chunks);
+	}
+
+	/* Clean up and turn off the lights; when asked for a fast exit, leave
+	 * that to the system rather than freeing every object one at a time */
+	if (fast_exit)
+	{
+		fflush(stdout);
+		return z;
+	}
 
-	/* Clean up and turn off the lights */
 	lua_close(L);
+	pool_destroy();
 	return z;
 }
 
 
 
+/**
+ * Called by Lua on an error outside of any protected call; it is about to
+ * abort the program, so say why first.
+ */
+static int panic(lua_State* L)
+{
+	printf(ERROR_MESSAGE, lua_tostring(L, -1));
+	return 0;
+}
+
+
+
 /**
  * Process the command line arguments, splitting them into options, the
  * target action, and any arguments to that action. The results are pushed
@@ -185,6 +253,15 @@ int process_option(lua_State* L, const char* arg)
 		scripts_path = value;
 	}
 
+	if (strcmp(key, "allocstats") == 0)
+		show_allocstats = 1;
+
+	if (strcmp(key, "fast-exit") == 0)
+		fast_exit = 1;
+
+	if (strcmp(key, "profile") == 0 && strlen(value) > 0)
+		profile_file = value;
+
 	return OKAY;
 }
 
@@ -261,6 +338,112 @@ int load_builtin_scripts(lua_State* L)
 
 
 #if defined(NDEBUG)
+/* the size of the header Lua puts at the start of its bytecode */
+#define BYTECODE_HEADER_SIZE  (12)
+
+static int use_bytecode = 0;
+
+
+typedef struct struct_Header
+{
+	char   bytes[BYTECODE_HEADER_SIZE];
+	size_t len;
+} Header;
+
+
+static int header_writer(lua_State* L, const void* p, size_t sz, void* ud)
+{
+	Header* header = (Header*)ud;
+	size_t n = BYTECODE_HEADER_SIZE - header->len;
+	(void)L;
+	if (sz < n)
+		n = sz;
+	memcpy(header->bytes + header->len, p, n);
+	header->len += n;
+	return 0;
+}
+
+
+/**
+ * The embedded bytecode can only be used if it was made by a Lua with the
+ * same version, byte order, and type sizes as this one, which is what its
+ * header records. Compare it to the header this Lua writes for an empty
+ * chunk; if they differ, as they might in a Universal build, the embedded
+ * source is used instead.
+ */
+static int check_bytecode(lua_State* L)
+{
+	Header header;
+
+	if (!builtin_bytecode[0].name)
+		return 0;
+
+	header.len = 0;
+	luaL_loadstring(L, "");
+	lua_dump(L, header_writer, &header);
+	lua_pop(L, 1);
+	return (header.len == BYTECODE_HEADER_SIZE && memcmp(header.bytes, builtin_bytecode_header, BYTECODE_HEADER_SIZE) == 0);
+}
+
+
+/* finds the bytecode for a built-in script, by name */
+static const BuiltinChunk* find_bytecode(const char* name)
+{
+	int i;
+	for (i = 0; builtin_bytecode[i].name; ++i)
+	{
+		if (strcmp(builtin_bytecode[i].name, name) == 0)
+			return &builtin_bytecode[i];
+	}
+	return NULL;
+}
+
+
+/**
+ * Compile one of the scripts which is loaded on demand, such as an action
+ * module, and return it as a function. Works like loadfile(), returning nil
+ * and a message if the script can't be found or compiled.
+ *
+ *   _loadbuiltin(name)
+ */
+static int load_builtin_module(lua_State* L)
+{
+	const char* name = luaL_checkstring(L, 1);
+	const BuiltinChunk* bytecode = (use_bytecode) ? find_bytecode(name) : NULL;
+	int i;
+
+	if (bytecode)
+	{
+		if (luaL_loadbuffer(L, bytecode->bytes, bytecode->size, name) != OKAY)
+		{
+			lua_pushnil(L);
+			lua_insert(L, -2);
+			return 2;
+		}
+		return 1;
+	}
+
+	for (i = 0; builtin_modules[i]; i += 2)
+	{
+		if (strcmp(builtin_modules[i], name) == 0)
+		{
+			const char* chunk = builtin_modules[i + 1];
+			if (luaL_loadbuffer(L, chunk, strlen(chunk), name) != OKAY)
+			{
+				lua_pushnil(L);
+				lua_insert(L, -2);
+				return 2;
+			}
+			return 1;
+		}
+	}
+
+	lua_pushnil(L);
+	lua_pushfstring(L, "no built-in script named %s", name);
+	return 2;
+}
+
+
 /**
  * When running in release mode, the scripts are loaded from a static data
  * buffer, where they were stored as bytecode by a preprocess. To regenerate
@@ -269,9 +452,25 @@ int load_builtin_scripts(lua_State* L)
 int load_builtin_scripts(lua_State* L)
 {
 	int i;
+
+	lua_pushcfunction(L, load_builtin_module);
+	lua_setglobal(L, "_loadbuiltin");
+
+	/* the bytecode, if present, lists the scripts first and in the same order */
+	use_bytecode = check_bytecode(L);
+
 	for (i = 0; builtin_scripts[i]; ++i)
 	{
-		if (luaL_dostring(L, builtin_scripts[i]) != OKAY)
+		int z;
+		if (use_bytecode)
+			z = luaL_loadbuffer(L, builtin_bytecode[i].bytes, builtin_bytecode[i].size, builtin_bytecode[i].name);
+		else
+			z = luaL_loadstring(L, builtin_scripts[i]);
+
+		if (z == OKAY)
+			z = lua_pcall(L, 0, LUA_MULTRET, 0);
+
+		if (z != OKAY)
 		{
 			printf(ERROR_MESSAGE, lua_tostring(L, -1));
 			return !OKAY;
@@ -40,25 +40,114 @@
 #define OKAY   (0)
 
 
+/* A precompiled built-in script; see scripts.c */
+typedef struct struct_BuiltinChunk
+{
+	const char* name;
+	size_t      size;
+	const char* bytes;
+} BuiltinChunk;
+
+
 /* Bootstrapping helper functions */
 int do_isfile(const char* filename);
+void do_sha1(const void* data, size_t length, unsigned char digest[20]);
+
+
+/* Path helpers; the returned strings must be freed by the caller */
+int   do_isabsolute(const char* path);
+char* do_getabsolute(const char* path);
+char* do_getrelative(const char* from, const char* to);
+char* do_join(const char* leading, const char* trailing);
+int   dirtree_iscanonical(const char* path);
+char* dirtree_getrelative(const char* src, const char* dst);
+
+
+/* Cached file system information; see os_statcache.c */
+#define STAT_NONE   (0)
+#define STAT_FILE   (1)
+#define STAT_DIR    (2)
+
+const char* do_getcwd();
+void        do_resetcwd();
+int         do_stat(const char* path);
+void        do_remember(const char* path, int kind);
+void        do_forget(const char* path);
+
+
+/* Cached directory listings, shared by the file matching functions */
+typedef struct struct_GlobListing
+{
+	char*  path;
+	long   mtime;
+	long   nsec;
+	char*  names;
+	size_t length;
+	size_t size;
+	size_t count;
+} GlobListing;
+
+int          globcache_enabled();
+GlobListing* globcache_find(const char* path, long mtime, long nsec);
+GlobListing* globcache_new(const char* path, long mtime, long nsec);
+void         globcache_add(GlobListing* listing, const char* name, int kind);
+void         globcache_store(GlobListing* listing);
+
+
+/* The Lua state's memory allocator; see os_pool.c */
+typedef struct struct_PoolStats
+{
+	size_t allocs;
+	size_t reallocs;
+	size_t frees;
+	size_t reused;
+	size_t chunks;
+	size_t bytes;
+	size_t peak;
+	size_t peaksince;
+} PoolStats;
+
+void*            pool_alloc(void* ud, void* ptr, size_t osize, size_t nsize);
+void             pool_destroy();
+const PoolStats* pool_getstats();
+
+
+/* The sampling profiler; see profile.c */
+void profile_start(lua_State* L, const char* filename);
+int  profile_stop(lua_State* L);
 
 
 /* Built-in functions */
+int path_getabsolute(lua_State* L);
+int path_getrelative(lua_State* L);
 int path_isabsolute(lua_State* L);
+int path_join(lua_State* L);
+int path_rebase(lua_State* L);
+int path_translate(lua_State* L);
+int os_allocstats(lua_State* L);
 int os_chdir(lua_State* L);
 int os_copyfile(lua_State* L);
+int os_flushcache(lua_State* L);
+int os_fork(lua_State* L);
 int os_getcwd(lua_State* L);
 int os_isdir(lua_State* L);
 int os_isfile(lua_State* L);
+int os_loadglobcache(lua_State* L);
+int os_loadscript(lua_State* L);
 int os_matchdone(lua_State* L);
 int os_matchisfile(lua_State* L);
 int os_matchname(lua_State* L);
 int os_matchnext(lua_State* L);
 int os_matchstart(lua_State* L);
+int os_matchwalk(lua_State* L);
 int os_mkdir(lua_State* L);
 int os_pathsearch(lua_State* L);
+int os_remove(lua_State* L);
+int os_rename(lua_State* L);
 int os_rmdir(lua_State* L);
+int os_saveglobcache(lua_State* L);
+int os_ticks(lua_State* L);
 int os_uuid(lua_State* L);
+int os_waitpid(lua_State* L);
 int string_endswith(lua_State* L);
 
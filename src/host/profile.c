@@ -0,0 +1,351 @@
+/**
+ * \file   profile.c
+ * \brief  A sampling profiler for the scripts, enabled with --profile.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ *
+ * \note A timer signal asks Lua to call a hook at its next instruction, and
+ *       the hook records the call stack at that point; the scripts run at
+ *       full speed in between. Time spent in a C function is charged to the
+ *       Lua function which called it. Where there is no profiling timer
+ *       (Windows) the hook runs every PROFILE_COUNT instructions instead.
+ *       The stacks are written in the "folded" format read by flame graph
+ *       tools, and a summary of the busiest functions is printed.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "premake.h"
+
+#if PLATFORM_WINDOWS
+#define snprintf  _snprintf
+#else
+#include <signal.h>
+#include <sys/time.h>
+#endif
+
+
+#define PROFILE_BUCKETS   (4096)
+#define PROFILE_COUNT     (1000)
+#define PROFILE_INTERVAL  (1000)
+#define PROFILE_MAX_STACK (8192)
+#define PROFILE_TOP       (20)
+
+
+typedef struct struct_Sample
+{
+	struct struct_Sample* next;
+	unsigned long count;
+	unsigned long total;
+	char name[1];
+} Sample;
+
+
+static Sample* stacks[PROFILE_BUCKETS];
+static char* outfile = NULL;
+static lua_State* profiled = NULL;
+
+#if !PLATFORM_WINDOWS
+static volatile sig_atomic_t ticks = 0;
+#endif
+
+
+
+static unsigned long hash_string(const char* str)
+{
+	unsigned long h = 5381;
+	while (*str)
+		h = h * 33 + (unsigned char)*str++;
+	return h;
+}
+
+
+static Sample* find_sample(Sample** buckets, const char* name, int create)
+{
+	unsigned long h = hash_string(name) % PROFILE_BUCKETS;
+	Sample* sample;
+
+	for (sample = buckets[h]; sample; sample = sample->next)
+	{
+		if (strcmp(sample->name, name) == 0)
+			return sample;
+	}
+
+	if (!create)
+		return NULL;
+
+	sample = (Sample*)malloc(sizeof(Sample) + strlen(name));
+	sample->count = 0;
+	sample->total = 0;
+	strcpy(sample->name, name);
+	sample->next = buckets[h];
+	buckets[h] = sample;
+	return sample;
+}
+
+
+/*
+ * Describes one stack frame, as "name (file:line)" for Lua functions or
+ * "name [C]" for C functions. The ';' which separates the frames of a
+ * folded stack can't appear in a name.
+ */
+static void describe_frame(lua_State* L, lua_Debug* ar, char* buffer, size_t size)
+{
+	const char* name;
+	char* ch;
+
+	lua_getinfo(L, "Sn", ar);
+	if (ar->name)
+		name = ar->name;
+	else if (*ar->what == 'm')
+		name = "main chunk";
+	else
+		name = "?";
+
+	if (*ar->what == 'C')
+		snprintf(buffer, size, "%s [C]", name);
+	else
+		snprintf(buffer, size, "%s (%s:%d)", name, ar->short_src, ar->linedefined);
+
+	for (ch = buffer; *ch; ++ch)
+	{
+		if (*ch == ';') *ch = ':';
+	}
+}
+
+
+/*
+ * Records the current call stack, outermost frame first.
+ */
+static void take_sample(lua_State* L, unsigned long weight)
+{
+	char frames[64][256];
+	char stack[PROFILE_MAX_STACK];
+	lua_Debug ar;
+	int depth, i;
+	size_t len = 0;
+
+	for (depth = 0; depth < 64 && lua_getstack(L, depth, &ar); ++depth)
+		describe_frame(L, &ar, frames[depth], sizeof(frames[depth]));
+
+	if (depth == 0)
+		return;
+
+	stack[0] = '\0';
+	for (i = depth - 1; i >= 0; --i)
+	{
+		size_t n = strlen(frames[i]);
+		if (len + n + 2 > PROFILE_MAX_STACK)
+			break;
+		if (len > 0)
+			stack[len++] = ';';
+		memcpy(stack + len, frames[i], n + 1);
+		len += n;
+	}
+
+	find_sample(stacks, stack, 1)->count += weight;
+}
+
+
+#if PLATFORM_WINDOWS
+
+static void sample_hook(lua_State* L, lua_Debug* ar)
+{
+	(void)ar;
+	take_sample(L, 1);
+}
+
+#else
+
+static void sample_hook(lua_State* L, lua_Debug* ar)
+{
+	unsigned long weight = (unsigned long)ticks;
+	(void)ar;
+	ticks = 0;
+	lua_sethook(L, NULL, 0, 0);
+	if (weight > 0)
+		take_sample(L, weight);
+}
+
+
+static void on_timer(int sig)
+{
+	(void)sig;
+	++ticks;
+	if (profiled)
+		lua_sethook(profiled, sample_hook, LUA_MASKCOUNT, 1);
+}
+
+#endif
+
+
+
+/*
+ * Starts sampling the state, to be written to the named file when stopped.
+ */
+void profile_start(lua_State* L, const char* filename)
+{
+#if !PLATFORM_WINDOWS
+	struct sigaction action;
+	struct itimerval timer;
+#endif
+
+	/* the scripts may change directories; remember where to write */
+	outfile = do_getabsolute(filename);
+	profiled = L;
+
+#if PLATFORM_WINDOWS
+	lua_sethook(L, sample_hook, LUA_MASKCOUNT, PROFILE_COUNT);
+#else
+	memset(&action, 0, sizeof(action));
+	action.sa_handler = on_timer;
+	action.sa_flags = SA_RESTART;
+	sigemptyset(&action.sa_mask);
+	sigaction(SIGPROF, &action, NULL);
+
+	timer.it_interval.tv_sec = 0;
+	timer.it_interval.tv_usec = PROFILE_INTERVAL;
+	timer.it_value = timer.it_interval;
+	setitimer(ITIMER_PROF, &timer, NULL);
+#endif
+}
+
+
+static int compare_samples(const void* a, const void* b)
+{
+	const Sample* sa = *(const Sample**)a;
+	const Sample* sb = *(const Sample**)b;
+	if (sa->count != sb->count)
+		return (sa->count < sb->count) ? 1 : -1;
+	if (sa->total != sb->total)
+		return (sa->total < sb->total) ? 1 : -1;
+	return strcmp(sa->name, sb->name);
+}
+
+
+/*
+ * Adds one folded stack to the per-function counts: the innermost frame
+ * gets the samples as its own, and every function on the stack gets them
+ * towards its total, but only once if it is recursive.
+ */
+static void add_functions(Sample** functions, const char* stack, unsigned long count)
+{
+	const char* start = stack;
+	for (;;)
+	{
+		const char* end = strchr(start, ';');
+		size_t len = (end) ? (size_t)(end - start) : strlen(start);
+		char name[256];
+		const char* earlier;
+		Sample* function;
+
+		if (len > 255) len = 255;
+		memcpy(name, start, len);
+		name[len] = '\0';
+		function = find_sample(functions, name, 1);
+
+		/* skip the total if the function appears further out */
+		for (earlier = strstr(stack, name); earlier && earlier < start; earlier = strstr(earlier + 1, name))
+		{
+			if ((earlier == stack || earlier[-1] == ';') && (earlier[len] == ';' || earlier[len] == '\0'))
+				break;
+		}
+		if (!earlier || earlier >= start)
+			function->total += count;
+
+		if (!end)
+		{
+			function->count += count;
+			return;
+		}
+		start = end + 1;
+	}
+}
+
+
+/*
+ * Stops sampling, writes the folded stacks to the profile file, and prints
+ * the functions with the most samples of their own.
+ */
+int profile_stop(lua_State* L)
+{
+	Sample* functions[PROFILE_BUCKETS];
+	Sample** sorted;
+	Sample* sample;
+	unsigned long total = 0;
+	size_t count = 0, i;
+	FILE* file;
+
+	if (!outfile)
+		return OKAY;
+
+#if PLATFORM_WINDOWS
+	lua_sethook(L, NULL, 0, 0);
+#else
+	{
+		struct itimerval timer;
+		memset(&timer, 0, sizeof(timer));
+		setitimer(ITIMER_PROF, &timer, NULL);
+		signal(SIGPROF, SIG_IGN);
+		lua_sethook(L, NULL, 0, 0);
+	}
+#endif
+	profiled = NULL;
+
+	file = fopen(outfile, "w");
+	if (!file)
+	{
+		printf("Unable to write profile to %s\n", outfile);
+		free(outfile);
+		outfile = NULL;
+		return !OKAY;
+	}
+
+	memset(functions, 0, sizeof(functions));
+	for (i = 0; i < PROFILE_BUCKETS; ++i)
+	{
+		for (sample = stacks[i]; sample; sample = sample->next)
+		{
+			fprintf(file, "%s %lu\n", sample->name, sample->count);
+			add_functions(functions, sample->name, sample->count);
+			total += sample->count;
+		}
+	}
+	fclose(file);
+
+	/* list the functions by their own samples */
+	for (i = 0; i < PROFILE_BUCKETS; ++i)
+	{
+		for (sample = functions[i]; sample; sample = sample->next)
+			++count;
+	}
+
+	sorted = (Sample**)malloc(sizeof(Sample*) * (count + 1));
+	count = 0;
+	for (i = 0; i < PROFILE_BUCKETS; ++i)
+	{
+		for (sample = functions[i]; sample; sample = sample->next)
+			sorted[count++] = sample;
+	}
+	qsort(sorted, count, sizeof(Sample*), compare_samples);
+
+	printf("Profile: %lu samples written to %s\n", total, outfile);
+	if (total > 0)
+	{
+		printf("   self   total  function\n");
+		for (i = 0; i < count && i < PROFILE_TOP; ++i)
+		{
+			printf("%6.1f%% %6.1f%%  %s\n",
+				100.0 * sorted[i]->count / total,
+				100.0 * sorted[i]->total / total,
+				sorted[i]->name);
+		}
+	}
+
+	for (i = 0; i < count; ++i)
+		free(sorted[i]);
+	free(sorted);
+	free(outfile);
+	outfile = NULL;
+	return OKAY;
+}
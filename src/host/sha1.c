@@ -0,0 +1,126 @@
+/**
+ * \file   sha1.c
+ * \brief  SHA-1 message digest, for deriving stable identifiers.
+ * \author Copyright (c) 2002-2009 Jason Perkins and the Premake project
+ *
+ * \note This follows FIPS 180-1 directly; it is used to make IDs, not for
+ *       anything which needs to be secure.
+ */
+
+#include <string.h>
+#include "premake.h"
+
+
+#define ROL(x, n)   ((((x) << (n)) | ((x) >> (32 - (n)))) & 0xFFFFFFFFUL)
+
+
+static void sha1_block(unsigned long state[5], const unsigned char* block)
+{
+	unsigned long w[80];
+	unsigned long a, b, c, d, e, f, k, temp;
+	int i;
+
+	for (i = 0; i < 16; ++i)
+	{
+		w[i] = ((unsigned long)block[i * 4] << 24) | ((unsigned long)block[i * 4 + 1] << 16) |
+		       ((unsigned long)block[i * 4 + 2] << 8) | (unsigned long)block[i * 4 + 3];
+	}
+	for (i = 16; i < 80; ++i)
+	{
+		w[i] = ROL(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+	}
+
+	a = state[0];
+	b = state[1];
+	c = state[2];
+	d = state[3];
+	e = state[4];
+
+	for (i = 0; i < 80; ++i)
+	{
+		if (i < 20)
+		{
+			f = (b & c) | ((~b) & d);
+			k = 0x5A827999UL;
+		}
+		else if (i < 40)
+		{
+			f = b ^ c ^ d;
+			k = 0x6ED9EBA1UL;
+		}
+		else if (i < 60)
+		{
+			f = (b & c) | (b & d) | (c & d);
+			k = 0x8F1BBCDCUL;
+		}
+		else
+		{
+			f = b ^ c ^ d;
+			k = 0xCA62C1D6UL;
+		}
+
+		temp = (ROL(a, 5) + (f & 0xFFFFFFFFUL) + e + k + w[i]) & 0xFFFFFFFFUL;
+		e = d;
+		d = c;
+		c = ROL(b, 30);
+		b = a;
+		a = temp;
+	}
+
+	state[0] = (state[0] + a) & 0xFFFFFFFFUL;
+	state[1] = (state[1] + b) & 0xFFFFFFFFUL;
+	state[2] = (state[2] + c) & 0xFFFFFFFFUL;
+	state[3] = (state[3] + d) & 0xFFFFFFFFUL;
+	state[4] = (state[4] + e) & 0xFFFFFFFFUL;
+}
+
+
+
+/*
+ * Computes the 20 byte digest of a block of memory.
+ */
+void do_sha1(const void* data, size_t length, unsigned char digest[20])
+{
+	unsigned long state[5] = { 0x67452301UL, 0xEFCDAB89UL, 0x98BADCFEUL, 0x10325476UL, 0xC3D2E1F0UL };
+	const unsigned char* bytes = (const unsigned char*)data;
+	unsigned char block[64];
+	size_t remaining = length;
+	unsigned long bits;
+	int i;
+
+	while (remaining >= 64)
+	{
+		sha1_block(state, bytes);
+		bytes += 64;
+		remaining -= 64;
+	}
+
+	/* pad with a single 1 bit, zeros, and the length in bits */
+	memset(block, 0, 64);
+	memcpy(block, bytes, remaining);
+	block[remaining] = 0x80;
+	if (remaining >= 56)
+	{
+		sha1_block(state, block);
+		memset(block, 0, 64);
+	}
+
+	bits = (unsigned long)length;
+	block[56] = (unsigned char)((bits >> 29) >> 24);
+	block[57] = (unsigned char)((bits >> 29) >> 16);
+	block[58] = (unsigned char)((bits >> 29) >> 8);
+	block[59] = (unsigned char)(bits >> 29);
+	block[60] = (unsigned char)(bits >> 21);
+	block[61] = (unsigned char)(bits >> 13);
+	block[62] = (unsigned char)(bits >> 5);
+	block[63] = (unsigned char)(bits << 3);
+	sha1_block(state, block);
+
+	for (i = 0; i < 5; ++i)
+	{
+		digest[i * 4]     = (unsigned char)(state[i] >> 24);
+		digest[i * 4 + 1] = (unsigned char)(state[i] >> 16);
+		digest[i * 4 + 2] = (unsigned char)(state[i] >> 8);
+		digest[i * 4 + 3] = (unsigned char)(state[i]);
+	}
+}
@@ -15,6 +15,7 @@
 --
 
 	local used_ids = {}
+	local newid = xcode.newid
 	
 	xcode.newid = function(node, usage)
 		-- assign special usages depending on where this node lives in the tree,
@@ -64,6 +65,43 @@
 	end
 
 
+---------------------------------------------------------------------------
+-- ID tests, using the real xcode.newid()
+---------------------------------------------------------------------------
+
+	local function idtree()
+		local root = premake.tree.new("MySolution")
+		premake.tree.add(root, "src/main.c")
+		premake.tree.add(root, "include/main.c")
+		return root
+	end
+
+	function T.xcode3.newid_IsSame_OnEachRun()
+		local a = idtree()
+		local b = idtree()
+		test.isequal(newid(a.children[1].children[1], "build"), newid(b.children[1].children[1], "build"))
+	end
+
+	function T.xcode3.newid_IsHexadecimal()
+		local id = newid(idtree())
+		test.isequal(24, #id)
+		test.istrue(id:find("^[0-9A-F]+$"))
+	end
+
+	function T.xcode3.newid_IsUnique_OnSameNameOrUsage()
+		local root = idtree()
+		local src = root.children[1].children[1]
+		local inc = root.children[2].children[1]
+		local ids = { newid(src), newid(inc), newid(src, "build"), newid(root), newid(root, "Debug") }
+		table.insert(ids, newid(src))
+		for i = 1, #ids do
+			for j = i + 1, #ids do
+				test.istrue(ids[i] ~= ids[j])
+			end
+		end
+	end
+
+
 ---------------------------------------------------------------------------
 -- Header/footer tests
 ---------------------------------------------------------------------------
@@ -26,6 +26,11 @@
 
 	function T.action.teardown()
 		premake.action.list["fake"] = nil
+		premake.action.modules["fake"] = nil
+		premake.action.modules["fakebase"] = nil
+		fake.execute = nil
+		fake.onsolution = nil
+		fake.onproject = nil
 	end
 
 
@@ -59,6 +64,58 @@
 		test.success(premake.action.call, "fake")
 	end
 
+	function T.action.CallWithJobs_CallsOnSolutionHere()
+		project "MyProject2"
+		premake.buildconfigs()
+		local called = false
+		fake.onsolution = function () called = true end
+		fake.onproject = function () end
+		premake.action.call("fake", 2)
+		test.istrue(called)
+	end
+
+	function T.action.CallWithJobs_RaisesFirstProjectError()
+		project "MyProject2"
+		project "MyProject3"
+		premake.buildconfigs()
+		fake.onproject = function (prj)
+			if prj.name ~= "MyProject" then
+				error("failed " .. prj.name, 0)
+			end
+		end
+		local ok, err = pcall(premake.action.call, "fake", 2)
+		test.isfalse(ok)
+		test.isequal("failed MyProject2", err)
+	end
+
+	function T.action.CallWithJobs_SkipsProjects_OnSolutionError()
+		project "MyProject2"
+		premake.buildconfigs()
+		fake.onsolution = function () error("failed solution", 0) end
+		fake.onproject = function (prj) os.mkdir("test_action_" .. prj.name) end
+		local ok, err = pcall(premake.action.call, "fake", 2)
+		local made = os.isdir("test_action_MyProject2")
+		os.rmdir("test_action_MyProject")
+		os.rmdir("test_action_MyProject2")
+		test.isequal("failed solution", err)
+		test.isfalse(made)
+	end
+
+	function T.action.CallWithJobs_KeepsWorkerTraceEvents()
+		project "MyProject2"
+		premake.buildconfigs()
+		fake.onproject = function (prj)
+			premake.trace.begin(prj.name, "test")
+			premake.trace.finish()
+		end
+		premake.trace.start()
+		premake.action.call("fake", 2)
+		local json = premake.trace.tojson()
+		premake.trace.stop()
+		test.istrue(json:find('"name":"MyProject","cat":"test"', 1, true))
+		test.istrue(json:find('"name":"MyProject2","cat":"test"', 1, true))
+	end
+
 
 --
 -- Tests for set()
@@ -71,3 +128,42 @@
 		test.isequal(_OS, "windows")
 		_OS = oldos
 	end
+
+
+
+--
+-- Tests for load()
+--
+
+	local loaded
+
+	local function addfakemodules()
+		loaded = { }
+		local function loader(fname)
+			return function() table.insert(loaded, fname) end
+		end
+		premake.action.addmodules({
+			{ triggers = { "fakebase" }, "base.lua" },
+			{ triggers = { "fake" }, requires = "fakebase", "one.lua", "two.lua" },
+		}, loader)
+	end
+
+	function T.action.load_RunsModuleScriptsInOrder_AfterRequired()
+		addfakemodules()
+		premake.action.load("fake")
+		test.isequal({ "base.lua", "one.lua", "two.lua" }, loaded)
+	end
+
+	function T.action.load_RunsModuleOnlyOnce()
+		addfakemodules()
+		premake.action.load("fake")
+		premake.action.load("fakebase")
+		premake.action.load("fake")
+		test.isequal(3, #loaded)
+	end
+
+	function T.action.set_LoadsModule()
+		addfakemodules()
+		premake.action.set("fakebase")
+		test.isequal({ "base.lua" }, loaded)
+	end
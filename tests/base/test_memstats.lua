@@ -0,0 +1,80 @@
+--
+-- tests/base/test_memstats.lua
+-- Automated test suite for the memory estimates.
+-- Copyright (c) 2009 Jason Perkins and the Premake project
+--
+
+	T.memstats = { }
+
+
+--
+-- estimate() tests
+--
+
+	function T.memstats.estimate_OnString()
+		test.isequal(28, premake.memstats.estimate("abc", { }))
+	end
+
+	function T.memstats.estimate_OnArray()
+		test.isequal(56 + 2 * 16 + 26 + 26, premake.memstats.estimate({ "a", "b" }, { }))
+	end
+
+	function T.memstats.estimate_OnHash()
+		test.isequal(56 + 4 * 40 + 3 * 26, premake.memstats.estimate({ a = 1, b = 2, c = 3 }, { }))
+	end
+
+	function T.memstats.estimate_CountsSharedValuesOnce()
+		local shared = { }
+		local size = premake.memstats.estimate({ shared, shared }, { })
+		test.isequal(56 + 2 * 16 + 56, size)
+	end
+
+	function T.memstats.estimate_SkipsSeenValues()
+		local shared = { "a" }
+		test.isequal(56 + 16, premake.memstats.estimate({ shared }, { [shared] = true }))
+	end
+
+
+--
+-- project() tests
+--
+
+	function T.memstats.project_LeavesOutSolution()
+		local sln, prj = test.createsolution()
+		premake.buildconfigs()
+		local result = premake.memstats.project(prj)
+		test.isequal("MyProject", result.name)
+		test.istrue(result.configs > 0)
+		test.isequal(result.total, result.blocks + result.configs + result.fileconfigs + result.other)
+	end
+
+	function T.memstats.project_LeavesOutValuesSharedWithOtherProjects()
+		local sln, prj = test.createsolution()
+		local other = project "MyOther"
+		premake.buildconfigs()
+		local before = premake.memstats.project(prj).other
+		local list = { "a list", "shared by both" }
+		prj.extra = list
+		other.extra = list
+		local shared = premake.memstats.project(prj).other
+		other.extra = nil
+		local owned = premake.memstats.project(prj).other
+		prj.extra = nil
+		test.isequal(before, shared)
+		test.istrue(owned > before)
+	end
+
+
+--
+-- os.allocstats() tests
+--
+
+	function T.memstats.allocstats_RestartsPeakSince()
+		local big = string.rep("x", 100000)
+		big = nil
+		collectgarbage("collect")
+		local before = os.allocstats(true)
+		local after = os.allocstats()
+		test.istrue(before.peaksince >= 100000)
+		test.istrue(after.peaksince < before.peaksince)
+	end
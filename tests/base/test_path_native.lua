@@ -0,0 +1,249 @@
+--
+-- tests/base/test_path_native.lua
+-- Checks the host implementations of the path functions against the
+-- script versions they replaced.
+-- Copyright (c) 2009 Jason Perkins and the Premake project
+--
+
+	T.path_native = { }
+
+
+--
+-- The original script implementations, kept here as the reference.
+--
+
+	local lua = { }
+
+	function lua.getabsolute(p)
+		-- normalize the target path
+		p = lua.translate(p, "/")
+		if (p == "") then p = "." end
+		
+		-- if the directory is already absolute I don't need to do anything
+		local result = iif (path.isabsolute(p), nil, os.getcwd())
+		
+		-- split up the supplied relative path and tackle it bit by bit
+		for n, part in ipairs(p:explode("/", true)) do
+			if (part == "" and n == 1) then
+				result = "/"
+			elseif (part == "..") then
+				result = path.getdirectory(result)
+			elseif (part ~= ".") then
+				result = lua.join(result, part)
+			end
+		end
+		
+		-- if I end up with a trailing slash remove it
+		result = iif(result:endswith("/"), result:sub(1, -2), result)
+		
+		return result
+	end
+
+	function lua.getrelative(src, dst)
+		-- normalize the two paths
+		src = lua.getabsolute(src)
+		dst = lua.getabsolute(dst)
+
+		-- same directory?
+		if (src == dst) then
+			return "."
+		end
+		
+		-- different drives? Must use absolute path
+		if path.getdrive(src) ~= path.getdrive(dst) then
+			return dst
+		end
+
+		src = src .. "/"
+		dst = dst .. "/"
+				
+		-- trim off the common directories from the front 
+		local i = src:find("/")
+		while (i) do
+			if (src:sub(1,i) == dst:sub(1,i)) then
+				src = src:sub(i + 1)
+				dst = dst:sub(i + 1)
+			else
+				break
+			end
+			i = src:find("/")
+		end
+
+		-- back up from dst to get to this common parent
+		local result = ""		
+		i = src:find("/")
+		while (i) do
+			result = result .. "../"
+			i = src:find("/", i + 1)
+		end
+
+		-- tack on the path down to the dst from here
+		result = result .. dst
+
+		-- remove the trailing slash
+		return result:sub(1, -2)
+	end
+
+	function lua.join(leading, trailing)
+		leading = leading or ""
+		
+		if (not trailing) then
+			return leading
+		end
+		
+		if (path.isabsolute(trailing)) then
+			return trailing
+		end
+
+		if (leading == ".") then
+			leading = ""
+		end
+		
+		if (leading:len() > 0 and not leading:endswith("/")) then
+			leading = leading .. "/"
+		end
+		
+		return leading .. trailing
+	end
+
+	function lua.translate(p, sep)
+		if (type(p) == "table") then
+			local result = { }
+			for _, value in ipairs(p) do
+				table.insert(result, lua.translate(value))
+			end
+			return result
+		else
+			if (not sep) then
+				if (os.is("windows")) then
+					sep = "\\"
+				else
+					sep = "/"
+				end
+			end
+			local result = p:gsub("[/\\]", sep)
+			return result
+		end
+	end
+
+	function lua.rebase(p, oldbase, newbase)
+		p = lua.getabsolute(lua.join(oldbase, p))
+		p = lua.getrelative(newbase, p)
+		return p
+	end
+
+
+
+--
+-- Sample paths, including the awkward cases: doubled and trailing
+-- separators, backslashes, drive letters, and ".." above the root.
+--
+
+	local samples = {
+		"", ".", "..", "/", "//", "\\", "a", "a/", "a//", "a/b", "a//b", "a/./b",
+		"./a", "../a", "../../a/b", "a/../b", "a/b/../..", "a/b/../../..",
+		"a\\b\\c", "a/b\\c/", "/a", "/a/b", "/a/../b", "/..", "/../..",
+		"/a//..", "/a/b/", "c:", "c:/", "c:/a", "c:/a/../b", "c:\\a\\b",
+		"d:/a", "C:/a", "x:a", "a:b", ".hidden", "a/.b/c", "...", "a/.../b",
+		"obj/Debug", "../obj/Debug/", "build/**", "src/*.c",
+	}
+
+
+	local function check(name, expected, actual, ...)
+		if expected ~= actual then
+			local args = { }
+			for i = 1, select("#", ...) do
+				table.insert(args, string.format("%q", tostring(select(i, ...))))
+			end
+			test.fail("path.%s(%s): expected %s but was %s", name, table.concat(args, ", "), tostring(expected), tostring(actual))
+		end
+	end
+
+
+
+--
+-- The tests.
+--
+
+	function T.path_native.getabsolute_MatchesScriptVersion()
+		for _, p in ipairs(samples) do
+			check("getabsolute", lua.getabsolute(p), path.getabsolute(p), p)
+		end
+	end
+
+	function T.path_native.getrelative_MatchesScriptVersion()
+		for _, src in ipairs(samples) do
+			for _, dst in ipairs(samples) do
+				check("getrelative", lua.getrelative(src, dst), path.getrelative(src, dst), src, dst)
+			end
+		end
+	end
+
+	function T.path_native.getrelative_MatchesScriptVersion_OnWorkingDirectory()
+		local cwd = os.getcwd()
+		for _, p in ipairs(samples) do
+			local dst = cwd .. "/" .. p
+			check("getrelative", lua.getrelative(cwd, dst), path.getrelative(cwd, dst), cwd, dst)
+			check("getrelative", lua.getrelative(dst, cwd), path.getrelative(dst, cwd), dst, cwd)
+		end
+	end
+
+	function T.path_native.getrelative_MatchesScriptVersion_OnSharedDirectories()
+		local dirs = { "/src", "/src/a", "/src/a/b", "/src/a/bb", "/src/ab", "/obj", "c:/src/a", "c:/src/a/b" }
+		local files = { "/src/a/b/x.c", "/src/a/x.c", "/src/a", "/src/a/b", "/src", "/src/ab/x.c", "/src/a/bb/b", "c:/src/a/x.c", "c:/src" }
+		-- twice, so the second pass is answered from the cache
+		for i = 1, 2 do
+			for _, src in ipairs(dirs) do
+				for _, dst in ipairs(files) do
+					check("getrelative", lua.getrelative(src, dst), path.getrelative(src, dst), src, dst)
+				end
+			end
+		end
+	end
+
+	function T.path_native.join_MatchesScriptVersion()
+		check("join", lua.join(nil, nil), path.join(nil, nil))
+		for _, leading in ipairs(samples) do
+			check("join", lua.join(leading, nil), path.join(leading), leading)
+			check("join", lua.join(nil, leading), path.join(nil, leading), nil, leading)
+			for _, trailing in ipairs(samples) do
+				check("join", lua.join(leading, trailing), path.join(leading, trailing), leading, trailing)
+			end
+		end
+	end
+
+	function T.path_native.rebase_MatchesScriptVersion()
+		for _, p in ipairs(samples) do
+			for _, oldbase in ipairs(samples) do
+				for _, newbase in ipairs({ "", ".", "..", "/", "a/b", "/a", "c:/a", "../obj" }) do
+					check("rebase", lua.rebase(p, oldbase, newbase), path.rebase(p, oldbase, newbase), p, oldbase, newbase)
+				end
+			end
+		end
+	end
+
+	function T.path_native.translate_MatchesScriptVersion()
+		for _, p in ipairs(samples) do
+			check("translate", lua.translate(p), path.translate(p), p)
+			for _, sep in ipairs({ "/", "\\", ".", "" }) do
+				check("translate", lua.translate(p, sep), path.translate(p, sep), p, sep)
+			end
+		end
+	end
+
+	function T.path_native.translate_MatchesScriptVersion_OnWindows()
+		_OPTIONS["os"] = "windows"
+		for _, p in ipairs(samples) do
+			check("translate", lua.translate(p), path.translate(p), p)
+		end
+	end
+
+	function T.path_native.translate_MatchesScriptVersion_OnList()
+		_OPTIONS["os"] = "windows"
+		local expected = lua.translate(samples, "/")
+		local actual = path.translate(samples, "/")
+		test.isequal(#expected, #actual)
+		for i = 1, #samples do
+			check("translate", expected[i], actual[i], samples[i])
+		end
+	end
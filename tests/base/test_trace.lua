@@ -0,0 +1,89 @@
+--
+-- tests/base/test_trace.lua
+-- Automated test suite for the trace event recorder.
+-- Copyright (c) 2009 Jason Perkins and the Premake project
+--
+
+	T.trace = { }
+
+
+--
+-- Setup/teardown
+--
+
+	function T.trace.setup()
+		premake.trace.start()
+	end
+
+	function T.trace.teardown()
+		premake.trace.stop()
+	end
+
+
+
+--
+-- Tests
+--
+
+	function T.trace.IsDisabled_AfterStop()
+		premake.trace.stop()
+		premake.trace.begin("ignored", "test")
+		premake.trace.finish()
+		test.isfalse(premake.trace.isenabled())
+		test.isequal('{"traceEvents":[\n\n]}\n', premake.trace.tojson())
+	end
+
+	function T.trace.WritesBeginAndEndEvents()
+		premake.trace.begin("MyProject", "collapse")
+		premake.trace.finish()
+		local json = premake.trace.tojson()
+		test.istrue(json:find('{"name":"MyProject","cat":"collapse","ph":"B","ts":0.000,"pid":1,"tid":1}', 1, true))
+		test.istrue(json:find('"ph":"E"', 1, true))
+	end
+
+	function T.trace.WritesArgs_InKeyOrder()
+		premake.trace.begin("os.matchfiles", "match", { pattern = "**.cpp" })
+		premake.trace.finish({ count = 12, bytes = 3 })
+		local json = premake.trace.tojson()
+		test.istrue(json:find('"args":{"pattern":"**.cpp"}', 1, true))
+		test.istrue(json:find('"args":{"bytes":3,"count":12}', 1, true))
+	end
+
+	function T.trace.EscapesStrings()
+		premake.trace.begin('C:\\a "b"\n', "dofile")
+		premake.trace.finish()
+		test.istrue(premake.trace.tojson():find('"name":"C:\\u005ca \\u0022b\\u0022\\u000a"', 1, true))
+	end
+
+	function T.trace.RecordsMatchfiles()
+		os.matchfiles("test_trace*.lua")
+		local json = premake.trace.tojson()
+		test.istrue(json:find('"name":"os.matchfiles","cat":"match"', 1, true))
+	end
+
+	local function countspans(json)
+		local _, begins = json:gsub('"ph":"B"', "")
+		local _, ends = json:gsub('"ph":"E"', "")
+		return begins, ends
+	end
+
+	function T.trace.ClosesDofileSpan_OnLoadError()
+		local ok = pcall(dofile, ".testignore")
+		local begins, ends = countspans(premake.trace.tojson())
+		test.isfalse(ok)
+		test.isequal(1, begins)
+		test.isequal(begins, ends)
+	end
+
+	function T.trace.ClosesDofileSpan_OnRaisedError()
+		local cwd = os.getcwd()
+		local builtin_loadscript = os.loadscript
+		os.loadscript = function() return function() error("raised", 0) end end
+		local ok, err = pcall(dofile, "folder/ok.lua")
+		os.loadscript = builtin_loadscript
+		local begins, ends = countspans(premake.trace.tojson())
+		test.isequal("raised", err)
+		test.isequal(cwd, os.getcwd())
+		test.isequal(1, begins)
+		test.isequal(begins, ends)
+	end
@@ -6,6 +6,9 @@
 
 	dofile("testfx.lua")
 
+	-- the suites cover every action, so load them all up front
+	premake.action.loadall()
+
 --
 -- Some helper functions
 --
@@ -57,7 +60,10 @@
 	dofile("test_gmake_cpp.lua")
 	dofile("test_gmake_cs.lua")
 	dofile("base/test_action.lua")
+	dofile("base/test_memstats.lua")
 	dofile("base/test_path.lua")
+	dofile("base/test_path_native.lua")
+	dofile("base/test_trace.lua")
 	dofile("base/test_tree.lua")
 	dofile("actions/test_clean.lua")
 	dofile("actions/test_xcode.lua")
@@ -67,12 +73,38 @@
 -- Register a test action
 --
 
+	newoption {
+		trigger     = "test-jobs",
+		value       = "N",
+		description = "Split the tests between N worker processes"
+	}
+
+	newoption {
+		trigger     = "test-times",
+		description = "List the twenty slowest tests"
+	}
+
 	newaction {
 		trigger     = "test",
 		description = "Run the automated test suite",
 		
 		execute = function ()
-			passed, failed = test.runall()
+			-- don't leave the script and listing caches behind in the tests
+			-- folder; they are kept beside this script, not the working folder
+			local cache = premake.globcache or premake.scriptcache
+			premake.scriptcache = nil
+			premake.globcache = nil
+			if cache then
+				os.rmdir(path.getdirectory(cache))
+			end
+
+			local showtimes = _OPTIONS["test-times"]
+			passed, failed, times = test.runall(tonumber(_OPTIONS["test-jobs"]))
+			if showtimes then
+				for i = 1, math.min(20, #times) do
+					printf("%9.2f ms  %s", times[i].time, times[i].name)
+				end
+			end
 			msg = string.format("%d tests passed, %d failed", passed, failed)
 			if (failed > 0) then
 				error(msg, 0)
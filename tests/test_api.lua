@@ -88,7 +88,78 @@
 	end
 	
 	
+--
+-- premake.setfilearray() tests
+--
+
+	function T.api.setfilearray_ExpandsMasks()
+		premake.CurrentConfiguration = { }
+		premake.CurrentConfiguration.files = { }
+		premake.setfilearray("config", "files", "folder/*.lua")
+		test.isequal({ path.getabsolute("folder/ok.lua") }, premake.CurrentConfiguration.files)
+	end
+
+	function T.api.setfilearray_KeepsOrder_OnSeveralMasks()
+		premake.CurrentConfiguration = { }
+		premake.CurrentConfiguration.files = { }
+		premake.setfilearray("config", "files", { "folder/*.lua", "b.c", "test_api.lua", "*_os.lua", "a.c" })
+		local expected = {
+			path.getabsolute("folder/ok.lua"),
+			path.getabsolute("b.c"),
+			path.getabsolute("test_api.lua"),
+			path.getabsolute("test_os.lua"),
+			path.getabsolute("a.c")
+		}
+		test.isequal(expected, premake.CurrentConfiguration.files)
+		test.isequal(5, #premake.CurrentConfiguration.files)
+	end
+
+	function T.api.setfilearray_PlacesMatchesAtEachMask_OnOverlappingMasks()
+		premake.CurrentConfiguration = { }
+		premake.CurrentConfiguration.files = { }
+		premake.setfilearray("config", "files", { "test_a*.lua", "a.c", "**_a*.lua" })
+		local expected = {
+			path.getabsolute("test_api.lua"),
+			path.getabsolute("a.c"),
+			path.getabsolute("test_api.lua"),
+			path.getabsolute("base/test_action.lua"),
+		}
+		test.isequal(expected, premake.CurrentConfiguration.files)
+	end
+
+	function T.api.setfilearray_KeepsOrder_OnMixedValues()
+		premake.CurrentConfiguration = { }
+		premake.CurrentConfiguration.files = { }
+		premake.setfilearray("config", "files", { "a.c", "folder/*.lua", "b.c", "folder/*.none" })
+		local expected = {
+			path.getabsolute("a.c"),
+			path.getabsolute("folder/ok.lua"),
+			path.getabsolute("b.c")
+		}
+		test.isequal(expected, premake.CurrentConfiguration.files)
+		test.isequal(3, #premake.CurrentConfiguration.files)
+	end
+	
+	
+	function T.api.setfilearray_SkipsGlobIgnoreNames()
+		globignore { "folder" }
+		premake.CurrentConfiguration = { }
+		premake.CurrentConfiguration.files = { }
+		premake.setfilearray("config", "files", "**.lua")
+		test.isfalse(table.contains(premake.CurrentConfiguration.files, path.getabsolute("folder/ok.lua")))
+		test.istrue(table.contains(premake.CurrentConfiguration.files, path.getabsolute("test_api.lua")))
+	end
 
+	function T.api.setfilearray_SkipsGlobIgnorePaths()
+		globignore { "base/**" }
+		premake.CurrentConfiguration = { }
+		premake.CurrentConfiguration.files = { }
+		premake.setfilearray("config", "files", path.getabsolute("**.lua"))
+		test.isfalse(table.contains(premake.CurrentConfiguration.files, path.getabsolute("base/test_path.lua")))
+		test.istrue(table.contains(premake.CurrentConfiguration.files, path.getabsolute("folder/ok.lua")))
+	end
+	
+	
 --
 -- premake.setstring() tests
 --
@@ -214,6 +285,16 @@
 		test.istrue(cfg == sln.blocks[#sln.blocks])
 	end
 	
+	function T.api.configuration_EscapesFilePatterns()
+		local cfg = configuration { files = "Src/*.c" }
+		test.isequal("src/[^/]*%.c", cfg.keywords[1])
+	end
+
+	function T.api.configuration_CompilesKeywords()
+		local cfg = configuration { "Debug" }
+		test.isequal("debug", cfg.matchers[1].literals[1])
+	end
+
 	function T.api.configuration_ReturnsCurrent_OnNoKeywords()
 		local cfg = configuration()
 		test.istrue(cfg == sln.blocks[1])
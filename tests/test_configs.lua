@@ -183,3 +183,154 @@
 		local cfg = premake.getconfig(prj, "Debug", "PS3")
 		test.isequal("StaticLib", cfg.kind)
 	end
+
+
+
+--
+-- List sharing
+--
+
+	function T.configs.SharesLists_OnSingleLevel()
+		project "MyProject"
+		includedirs { "include" }
+		prepare()
+		local release = premake.getconfig(prj, "Release")
+		test.istrue(cfg.includedirs == release.includedirs)
+	end
+
+	function T.configs.JoinsLists_OnSeveralLevels()
+		prepare()
+		test.isequal("SOLUTION:SOLUTION_DEBUG:PROJECT:DEBUG:NATIVE", table.concat(cfg.defines, ":"))
+	end
+
+	function T.configs.AdjustsSharedLists_PerProject()
+		solution "MySolution"
+		includedirs { "include" }
+		project "MyProject"
+		location "build"
+		local other = project "MyOther"
+		language "C"
+		kind "ConsoleApp"
+		prepare()
+		test.isequal("../include", cfg.includedirs[1])
+		test.isequal("include", premake.getconfig(other, "Debug").includedirs[1])
+	end
+
+
+
+--
+-- File lists
+--
+
+	function T.configs.FileLists_DropDuplicates()
+		project "MyProject"
+		files { "hello.c", "goodbye.c", "hello.c" }
+		prepare()
+		test.isequal("hello.c:goodbye.c", table.concat(cfg.files, ":"))
+	end
+
+	function T.configs.FileLists_SkipExcludes()
+		project "MyProject"
+		files { "hello.c", "goodbye.c" }
+		configuration "Release"
+		excludes { "hello.c" }
+		prepare()
+		test.isequal("hello.c:goodbye.c", table.concat(cfg.files, ":"))
+		test.isequal("goodbye.c", table.concat(premake.getconfig(prj, "Release").files, ":"))
+	end
+
+	function T.configs.FileLists_AreShared_OnSameFiles()
+		project "MyProject"
+		files { "hello.c", "goodbye.c" }
+		prepare()
+		test.istrue(prj.files == cfg.files)
+		test.istrue(prj.files == premake.getconfig(prj, "Release", "x32").files)
+	end
+
+	function T.configs.FileLists_KeepConfigFiles()
+		project "MyProject"
+		files { "hello.c" }
+		configuration "Debug"
+		files { "debug.c" }
+		prepare()
+		test.isequal("hello.c:debug.c", table.concat(cfg.files, ":"))
+		test.isequal("hello.c", table.concat(prj.files, ":"))
+	end
+
+	function T.configs.FileLists_KeepScriptOrder_OnConfigFilesFirst()
+		project "MyProject"
+		configuration "Debug"
+		files { "debug.c" }
+		configuration { }
+		files { "hello.c", "goodbye.c" }
+		configuration "Release"
+		files { "release.c" }
+		configuration { }
+		files { "last.c" }
+		prepare()
+		test.isequal("debug.c:hello.c:goodbye.c:last.c", table.concat(cfg.files, ":"))
+		test.isequal("hello.c:goodbye.c:release.c:last.c", table.concat(premake.getconfig(prj, "Release").files, ":"))
+		test.isequal("hello.c:goodbye.c:last.c", table.concat(prj.files, ":"))
+	end
+
+
+
+--
+-- Per-file configurations
+--
+
+	function T.configs.FileConfigs_AreBuiltOnFirstUse()
+		project "MyProject"
+		files { "hello.c" }
+		prepare()
+		test.isnil(rawget(prj.__fileconfigs, "hello.c"))
+		test.isequal("hello.c", prj.__fileconfigs["hello.c"].name)
+		test.istrue(rawget(prj.__fileconfigs, "hello.c") ~= nil)
+	end
+
+	function T.configs.FileConfigs_ShareSettings_OnSameBlocks()
+		project "MyProject"
+		files { "hello.c", "goodbye.c" }
+		prepare()
+		test.istrue(getmetatable(prj.__fileconfigs[1]) == getmetatable(prj.__fileconfigs[2]))
+	end
+
+	function T.configs.FileConfigs_MergeFileBlocks()
+		project "MyProject"
+		files { "hello.c", "goodbye.c" }
+		configuration { files = "hello.c" }
+		defines "HELLO"
+		prepare()
+		test.isequal("HELLO", prj.__fileconfigs["hello.c"].defines[1])
+		test.isnil(prj.__fileconfigs["goodbye.c"].defines)
+	end
+
+	function T.configs.FileConfigs_SkipNegatedFileKeywords()
+		project "MyProject"
+		files { "hello.c", "goodbye.c" }
+		configuration { "*.c", "not hello.c" }
+		defines "NOTHELLO"
+		prepare()
+		test.isnil(prj.__fileconfigs["hello.c"].defines)
+		test.isequal("NOTHELLO", prj.__fileconfigs["goodbye.c"].defines[1])
+	end
+
+	function T.configs.FileConfigs_ReturnNil_OnUnknownFile()
+		project "MyProject"
+		files { "hello.c" }
+		prepare()
+		test.isnil(prj.__fileconfigs["nothere.c"])
+	end
+
+	function T.configs.FileConfigs_MatchPrefixAndSuffixBlocks()
+		project "MyProject"
+		files { "src/hello.c", "src/hello.h", "goodbye.c" }
+		configuration { files = "src/**" }
+		defines "SRC"
+		configuration { files = "**.c" }
+		defines "CFILE"
+		prepare()
+		test.isequal("SRC:CFILE", table.concat(prj.__fileconfigs["src/hello.c"].defines, ":"))
+		test.isequal("SRC", table.concat(prj.__fileconfigs["src/hello.h"].defines, ":"))
+		test.isequal("CFILE", table.concat(prj.__fileconfigs["goodbye.c"].defines, ":"))
+	end
@@ -89,3 +89,57 @@
 	function T.keywords.match_fail_required_term()
 		test.isfalse(premake.iskeywordsmatch({ "debug" }, { "debug", "windows", "vs2005", required="hello.c" }))
 	end
+
+
+	function T.keywords.match_ok_required_pattern()
+		test.istrue(premake.iskeywordsmatch({ "src/.*%.c" }, { "debug", "windows", "vs2005", required="src/lib/hello.c" }))
+	end
+
+
+
+--
+-- Keyword compilation tests
+--
+
+	function T.keywords.compiles_literals()
+		local matcher = premake.compilekeyword("windows or linux")
+		test.isequal({ "windows", "linux" }, matcher.literals)
+		test.isequal(0, #matcher.patterns)
+	end
+
+
+	function T.keywords.compiles_escaped_literals()
+		local matcher = premake.compilekeyword("hello%.c")
+		test.isequal("hello.c", matcher.literals[1])
+	end
+
+
+	function T.keywords.compiles_anchored_patterns()
+		local matcher = premake.compilekeyword("vs20[^/]*")
+		test.isequal("^vs20[^/]*$", matcher.patterns[1])
+	end
+
+
+	function T.keywords.compiles_prefixes()
+		local matcher = premake.compilekeyword("src/.*")
+		test.isequal("src/", matcher.prefixes[1])
+		test.isequal(0, #matcher.patterns)
+	end
+
+
+	function T.keywords.compiles_suffixes()
+		local matcher = premake.compilekeyword(".*%.cpp")
+		test.isequal(".cpp", matcher.suffixes[1])
+		test.isequal(0, #matcher.patterns)
+	end
+
+
+	function T.keywords.matches_with_prefixes()
+		test.istrue(premake.iskeywordmatch("vs20.*", { "debug", "windows", "vs2005" }))
+		test.isfalse(premake.iskeywordmatch("vs20.*", { "debug", "windows", "gmake" }))
+	end
+
+
+	function T.keywords.compiles_not()
+		test.istrue(premake.compilekeyword("not windows").negated)
+	end
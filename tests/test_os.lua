@@ -7,6 +7,25 @@
 
 	T.os = { }
 
+	-- the test runner replaces io.open; the cache tests write real files
+	local builtin_open = io.open
+
+	
+--
+-- os.allocstats() tests
+--
+
+	function T.os.allocstats_CountsAllocations()
+		local before = os.allocstats()
+		local t = { }
+		for i = 1, 100 do
+			t[i] = { i }
+		end
+		local after = os.allocstats()
+		test.istrue(after.allocs >= before.allocs + 100)
+		test.istrue(after.peak >= after.bytes)
+	end
+	
 	
 --
 -- os.findlib() tests
@@ -23,6 +42,21 @@
 	
 	
 	
+--
+-- os.fork() and os.waitpid() tests
+--
+
+	function T.os.waitpid_ReturnsExitCode()
+		if os.is("windows") then return end
+		local pid = os.fork()
+		if pid == 0 then
+			os.exit(3)
+		end
+		test.isequal(3, os.waitpid(pid))
+	end
+
+
+
 --
 -- os.isfile() tests
 --
@@ -35,6 +69,110 @@
 		test.isfalse(os.isfile("no_such_file.lua"))
 	end
 
+	function T.os.isfile_ReturnsTrue_OnCopiedFile()
+		test.isfalse(os.isfile("test_os.tmp"))
+		os.copyfile("test_os.lua", "test_os.tmp")
+		local created = os.isfile("test_os.tmp")
+		os.remove("test_os.tmp")
+		test.istrue(created)
+		test.isfalse(os.isfile("test_os.tmp"))
+	end
+
+	function T.os.isfile_ReturnsTrue_OnFileCopiedIntoFolder()
+		os.mkdir("test_os_copy")
+		test.isfalse(os.isfile("test_os_copy/test_os.lua"))
+		os.copyfile("test_os.lua", "test_os_copy")
+		local created = os.isfile("test_os_copy/test_os.lua")
+		os.rmdir("test_os_copy")
+		test.istrue(created)
+	end
+
+
+
+--
+-- os.isdir(), os.mkdir(), and os.rmdir() tests
+--
+
+	function T.os.isdir_FollowsMkdirAndRmdir()
+		test.isfalse(os.isdir("test_os_dir/sub"))
+		os.mkdir("test_os_dir/sub")
+		test.istrue(os.isdir("test_os_dir/sub"))
+		test.istrue(os.isdir("./test_os_dir/../test_os_dir/sub/"))
+		os.rmdir("test_os_dir")
+		test.isfalse(os.isdir("test_os_dir/sub"))
+		test.isfalse(os.isdir("test_os_dir"))
+	end
+
+
+
+--
+-- os.getcwd() tests
+--
+
+	function T.os.getcwd_FollowsChdir()
+		local cwd = os.getcwd()
+		os.chdir("folder")
+		local inner = os.getcwd()
+		os.chdir(cwd)
+		test.isequal(cwd .. "/folder", inner)
+		test.isequal(cwd, os.getcwd())
+	end
+
+
+
+--
+-- os.loadscript() tests
+--
+
+	function T.os.loadscript_ReturnsChunk()
+		local chunk = os.loadscript("folder/ok.lua")
+		test.isequal("ok", chunk())
+	end
+
+	function T.os.loadscript_ReturnsError_OnBadScript()
+		local chunk, err = os.loadscript(".testignore")
+		test.isnil(chunk)
+		test.istrue(err:find(".testignore:4:", 1, true))
+	end
+
+	function T.os.loadscript_ReusesCachedChunk()
+		local dir = path.getabsolute("test_os_cache")
+		local fname = path.getabsolute("folder/ok.lua")
+		os.mkdir(dir)
+		local first = os.loadscript(fname, dir)()
+		local cached = os.matchfiles("test_os_cache/*")
+		local second = os.loadscript(fname, dir)()
+		os.rmdir(dir)
+		test.isequal("ok", first)
+		test.isequal("ok", second)
+		test.isequal(1, #cached)
+	end
+
+	function T.os.loadscript_Recompiles_OnDamagedCache()
+		local dir = path.getabsolute("test_os_cache")
+		local fname = path.getabsolute("folder/ok.lua")
+		os.mkdir(dir)
+		os.loadscript(fname, dir)
+		local cached = os.matchfiles("test_os_cache/*")[1]
+		os.copyfile(fname, cached)
+		local result = os.loadscript(fname, dir)()
+		local rewritten = os.loadscript(fname, dir)()
+		os.rmdir(dir)
+		test.isequal("ok", result)
+		test.isequal("ok", rewritten)
+	end
+
+	function T.os.loadscript_CreatesCacheFolder()
+		local dir = path.getabsolute("test_os_cache/.premake/cache")
+		local fname = path.getabsolute("folder/ok.lua")
+		os.loadscript(fname, dir)
+		local cached = os.matchfiles("test_os_cache/.premake/cache/*")
+		local walked = os.matchfiles("test_os_cache/**")
+		os.rmdir("test_os_cache")
+		test.isequal(1, #cached)
+		test.isequal(0, #walked)
+	end
+
 
 
 --
@@ -50,6 +188,158 @@
 		local result = os.matchfiles("*.lua")
 		test.isfalse(table.contains(result, "folder/ok.lua"))		
 	end
+
+	function T.os.matchfiles_OnSubdirectoryMask()
+		local result = os.matchfiles("folder/*.lua")
+		test.isequal({ "folder/ok.lua" }, result)
+	end
+
+	function T.os.matchfiles_RemovesDotDirectory()
+		local result = os.matchfiles("./test_os.lua")
+		test.isequal({ "test_os.lua" }, result)
+	end
+
+	function T.os.matchfiles_SkipsDirectories()
+		local result = os.matchfiles("*")
+		test.isfalse(table.contains(result, "folder"))
+	end
+
+	function T.os.matchfiles_KeepsMaskOrder_OnMultipleMasks()
+		local expected = os.matchfiles("test_*.lua")
+		table.insert(expected, "folder/ok.lua")
+		local result = os.matchfiles("test_*.lua", "folder/*.lua")
+		test.isequal(expected, result)
+	end
+
+
+	function T.os.matchfiles_ExpandsBraces()
+		local result = os.matchfiles("folder/*.{lua,txt}")
+		test.isequal({ "folder/ok.lua" }, result)
+	end
+
+	function T.os.matchfiles_WalksParentMasks_WithRecursiveMask()
+		local result = os.matchfiles("**.none", "../tests/folder/*.lua", "./folder/*.lua")
+		test.istrue(table.contains(result, "../tests/folder/ok.lua"))
+		test.istrue(table.contains(result, "./folder/ok.lua"))
+	end
+
+	function T.os.matchfiles_KeepsDuplicates_OnRepeatedMask()
+		local result = os.matchfiles("folder/*.lua", "folder/*.lua")
+		test.isequal({ "folder/ok.lua", "folder/ok.lua" }, result)
+	end
+
+	function T.os.matchfiles_ListsFileForEachMask_OnOverlappingMasks()
+		local result = os.matchfiles("**.lua", "folder/*.lua")
+		test.istrue(table.contains(result, "folder/ok.lua"))
+		test.isequal("folder/ok.lua", result[#result])
+		test.isequal(#os.matchfiles("**.lua") + 1, #result)
+	end
+
+	function T.os.matchwalk_SkipsExcludedNames()
+		local result = { }
+		os.matchwalk(result, "**.lua", true, { "folder" })
+		test.isfalse(table.contains(result, "folder/ok.lua"))
+		test.istrue(table.contains(result, "test_os.lua"))
+	end
+
+	function T.os.matchwalk_SkipsExcludedPaths()
+		local result = { }
+		os.matchwalk(result, "**.lua", true, { "base/**", "test_*.lua" })
+		test.isfalse(table.contains(result, "base/test_path.lua"))
+		test.isfalse(table.contains(result, "test_os.lua"))
+		test.istrue(table.contains(result, "folder/ok.lua"))
+	end
+
+	function T.os.matchwalk_PrunesExcludedDirectories()
+		local result = { }
+		os.matchwalk(result, "**.lua", true, { "base/", "folder/**" })
+		test.isfalse(table.contains(result, "base/test_path.lua"))
+		test.isfalse(table.contains(result, "folder/ok.lua"))
+		test.istrue(table.contains(result, "test_os.lua"))
+	end
+
+	function T.os.matchwalk_SkipsIgnoreFilePatterns()
+		local result = { }
+		os.matchwalk(result, "**.lua", true, nil, ".testignore")
+		test.isfalse(table.contains(result, "folder/ok.lua"))
+		test.isfalse(table.contains(result, "test_api.lua"))
+		test.isfalse(table.contains(result, "base/test_path.lua"))
+		test.istrue(table.contains(result, "test_os.lua"))
+	end
+
+	function T.os.matchfiles_UsesSavedListings()
+		local fname = path.getabsolute("test_os.globcache")
+		os.loadglobcache(fname)
+		local expected = os.matchfiles("folder/**")
+		test.istrue(os.saveglobcache(fname))
+		os.loadglobcache(fname)
+		os.remove(fname)
+		test.isequal(expected, os.matchfiles("folder/**"))
+		test.isfalse(os.saveglobcache(fname))
+	end
+
+	local function writefile(fname, contents)
+		local f = builtin_open(fname, "wb")
+		f:write(contents)
+		f:close()
+	end
+
+	function T.os.loadglobcache_IgnoresDamagedFile_OnShortLine()
+		local fname = path.getabsolute("test_os.globcache")
+		writefile(fname, "premake-globcache 1\n1 2\n1 2 /x\n")
+		os.loadglobcache(fname)
+		os.remove(fname)
+		test.isequal({ "folder/ok.lua" }, os.matchfiles("folder/*.lua"))
+	end
+
+	function T.os.loadglobcache_IgnoresDamagedFile_OnUnterminatedNames()
+		local fname = path.getabsolute("test_os.globcache")
+		os.loadglobcache(fname)
+		os.matchfiles("folder/*")
+		os.saveglobcache(fname)
+		local f = builtin_open(fname, "rb")
+		local contents = f:read("*a")
+		f:close()
+		writefile(fname, (contents:gsub("%z", "x")))
+		os.loadglobcache(fname)
+		os.remove(fname)
+		test.isequal({ "folder/ok.lua" }, os.matchfiles("folder/*.lua"))
+	end
+
+	function T.os.matchfiles_ReturnsSortedResults()
+		local result = os.matchfiles("*.lua")
+		local sorted = table.join(result)
+		table.sort(sorted)
+		test.isequal(sorted, result)
+	end
+
+	function T.os.matchfiles_SameResults_OnAnyThreadCount()
+		local threads = _OPTIONS["glob-threads"]
+		_OPTIONS["glob-threads"] = "1"
+		local expected = os.matchfiles("**.lua")
+		_OPTIONS["glob-threads"] = "4"
+		local actual = os.matchfiles("**.lua")
+		_OPTIONS["glob-threads"] = threads
+		test.isequal(#expected, #actual)
+		test.isequal(expected, actual)
+	end
+
+
+--
+-- os.matchdirs() tests
+--
+
+	function T.os.matchdirs_ReturnsDirectories()
+		local result = os.matchdirs("*")
+		test.istrue(table.contains(result, "folder"))
+		test.isfalse(table.contains(result, "test_os.lua"))
+	end
+
+	function T.os.matchdirs_Recursive()
+		local result = os.matchdirs("**")
+		test.istrue(table.contains(result, "base"))
+		test.isfalse(table.contains(result, "folder/ok.lua"))
+	end
 	
 
 	
@@ -90,4 +380,14 @@
 		test.isequal("-", g:sub(19,19))
 		test.isequal("-", g:sub(24,24))
 	end
+
+	function T.os.uuid_IsSame_OnSameName()
+		test.isequal("D9F7ACFB-3E0B-54C6-969F-395E9D2591C6", os.uuid("MySolution/MyProject"))
+		test.isequal(os.uuid("MySolution/MyProject"), os.uuid("MySolution/MyProject"))
+	end
+
+	function T.os.uuid_IsDifferent_OnDifferentName()
+		test.istrue(os.uuid("MySolution/MyProject") ~= os.uuid("MySolution/MyOtherProject"))
+		test.isequal("0D9181A8-165D-5978-9989-0A019BF22C54", os.uuid(string.rep("x", 100)))
+	end
 	
@@ -45,3 +45,38 @@
 		premake.generate(prj, "%%.prj", function () end)
 		test.closedfile(true)
 	end
+
+
+
+--
+-- verifystable() tests
+--
+
+	local fake = {
+		trigger = "fake",
+		description = "Fake action used for testing",
+	}
+
+	function T.premake.teardown()
+		premake.action.list["fake"] = nil
+	end
+
+	function T.premake.verifystable_Passes_OnSameOutput()
+		fake.execute = function() premake.generated["a.txt"] = "same" end
+		premake.action.list["fake"] = fake
+		test.istrue(premake.verifystable("fake"))
+		test.isnil(premake.generated)
+	end
+
+	function T.premake.verifystable_ListsChangedFiles()
+		local count = 0
+		fake.execute = function()
+			count = count + 1
+			premake.generated["a.txt"] = "same"
+			premake.generated["b.txt"] = "run " .. count
+		end
+		premake.action.list["fake"] = fake
+		local ok, err = premake.verifystable("fake")
+		test.isfalse(ok)
+		test.isequal("output is not stable between runs:\n\tb.txt", err)
+	end
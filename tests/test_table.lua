@@ -44,3 +44,31 @@
 	function T.table.isempty_ReturnsFalseOnNotEmpty()
 		test.isfalse(table.isempty({ 1 }))
 	end
+
+
+--
+-- table.sortedpairs() tests
+--
+
+	function T.table.sortedpairs_VisitsKeysInOrder()
+		local t = { c = 3, a = 1, b = 2, [2] = "y", [1] = "x" }
+		local keys, values = { }, { }
+		for k, v in table.sortedpairs(t) do
+			table.insert(keys, k)
+			table.insert(values, v)
+		end
+		test.isequal({ 1, 2, "a", "b", "c" }, keys)
+		test.isequal({ "x", "y", 1, 2, 3 }, values)
+	end
+
+	function T.table.sortedpairs_OnEmpty()
+		for k in table.sortedpairs({ }) do
+			test.fail("visited %s", tostring(k))
+		end
+	end
+
+	function T.table.sortedpairs_Fails_OnTableKey()
+		local ok, err = pcall(table.sortedpairs, { [{ }] = 1 })
+		test.isfalse(ok)
+		test.istrue(err:find("table key", 1, true))
+	end
@@ -205,40 +205,185 @@
 	end
 
 
-	function test.runall()		
+--
+-- Runs the tests at the given places in a list, and returns a result for
+-- each: whether it passed, the error if not, and the time it took in
+-- microseconds. Results are keyed by the test's place in the list.
+--
+
+	local function test_range(tests, indices)
+		local results = { }
+		for _, i in ipairs(indices) do
+			local t = tests[i]
+			local start = os.ticks()
+			local ok, err = test_setup(t.suite, t.fn)
+
+			if ok then
+				ok, err = test_run(t.suite, t.fn)
+			end
+
+			local tok, terr = test_teardown(t.suite, t.fn)
+			ok = ok and tok
+			err = err or terr
+
+			results[i] = { ok = ok, err = err, time = os.ticks() - start }
+		end
+		return results
+	end
+
+
+--
+-- Splits the tests between forked worker processes, each of which writes
+-- its results to a temporary file for this process to collect. A suite is
+-- never split, as its tests may share files on the disk; the biggest suites
+-- are handed out first, each to the worker with the fewest tests so far.
+-- The share of any worker which can't be started is run here instead, so
+-- where processes can't be forked, as on Windows, every share runs here.
+--
+
+	local function test_shares(tests, jobs)
+		local suites = { }
+		for i, t in ipairs(tests) do
+			local last = suites[#suites]
+			if not last or last.suite ~= t.suite then
+				last = { suite = t.suite, first = i }
+				table.insert(suites, last)
+			end
+			last.count = i - last.first + 1
+		end
+		table.sort(suites, function(a, b)
+			if a.count ~= b.count then
+				return a.count > b.count
+			end
+			return a.first < b.first
+		end)
+
+		local shares = { }
+		for i = 1, jobs do
+			shares[i] = { }
+		end
+		for _, s in ipairs(suites) do
+			local share = shares[1]
+			for i = 2, jobs do
+				if #shares[i] < #share then
+					share = shares[i]
+				end
+			end
+			for i = s.first, s.first + s.count - 1 do
+				table.insert(share, i)
+			end
+		end
+		return shares
+	end
+
+	local function test_forked(tests, jobs, open)
+		local workers = { }
+		for i, share in ipairs(test_shares(tests, jobs)) do
+			local fname = os.tmpname()
+			local pid = os.fork()
+			if pid == 0 then
+				-- whatever happens, the worker must not return to the caller
+				local ok = pcall(function()
+					local f = open(fname, "w")
+					for k, r in pairs(test_range(tests, share)) do
+						f:write(string.format("{ %d, %s, %.0f, %q },\n", k, tostring(r.ok), r.time, tostring(r.err or "")))
+					end
+					f:close()
+				end)
+				os.exit(iif(ok, 0, 1))
+			end
+			table.insert(workers, { share = share, pid = pid, fname = fname })
+		end
+
+		local results = { }
+		for _, w in ipairs(workers) do
+			if not w.pid then
+				os.remove(w.fname)
+				for k, r in pairs(test_range(tests, w.share)) do
+					results[k] = r
+				end
+			else
+				local code, err = os.waitpid(w.pid)
+				local f = open(w.fname, "r")
+				local chunk = f and loadstring("return {" .. f:read("*a") .. "}")
+				if f then f:close() end
+				os.remove(w.fname)
+
+				local collected = (code == 0 and chunk) and chunk() or { }
+				for _, r in ipairs(collected) do
+					results[r[1]] = { ok = r[2], err = r[4], time = r[3] }
+				end
+				for _, k in ipairs(w.share) do
+					if not results[k] then
+						results[k] = { ok = false, err = "worker process failed: " .. (err or "exit code " .. tostring(code)), time = 0 }
+					end
+				end
+			end
+		end
+		return results
+	end
+
+
+--
+-- Runs all of the test suites, in order by name.
+--
+-- @param jobs
+--    The number of worker processes to split the tests between; if one or
+--    not set, all of the tests are run in this process.
+-- @returns
+--    The number of tests passed and failed, and the list of tests with the
+--    time each one took in milliseconds, slowest first.
+--
+
+	function test.runall(jobs)
+		local builtin_open = io.open
 		test.print = print
 
 		print      = stub_print
 		io.open    = stub_io_open
 		io.output  = stub_io_output
 		
-		local numpassed = 0
-		local numfailed = 0
-		
-		for suitename, suitetests in pairs(T) do
-			for testname, testfunc in pairs(suitetests) do
-
-				local ok, err = test_setup(suitetests, testfunc)
-
-				if ok then
-					ok, err = test_run(suitetests, testfunc)
+		local tests = { }
+		for suitename, suitetests in table.sortedpairs(T) do
+			for testname, testfunc in table.sortedpairs(suitetests) do
+				if testname ~= "setup" and testname ~= "teardown" then
+					table.insert(tests, { name = suitename .. "." .. testname, suite = suitetests, fn = testfunc })
 				end
+			end
+		end
 
-				local tok, terr = test_teardown(suitetests, testfunc)
-				ok = ok and tok
-				err = err or tok
-				
-				if (not ok) then
-					test.print(string.format("%s.%s: %s", suitename, testname, err))
-					numfailed = numfailed + 1
-				else
-					numpassed = numpassed + 1
-				end
+		local results
+		if jobs and jobs > 1 then
+			results = test_forked(tests, jobs, builtin_open)
+		end
+		if not results then
+			local all = { }
+			for i = 1, #tests do
+				all[i] = i
+			end
+			results = test_range(tests, all)
+		end
 
+		local numpassed = 0
+		local numfailed = 0
+		local times = { }
+		for i, t in ipairs(tests) do
+			local r = results[i]
+			if (not r.ok) then
+				test.print(string.format("%s: %s", t.name, r.err))
+				numfailed = numfailed + 1
+			else
+				numpassed = numpassed + 1
 			end
+			table.insert(times, { name = t.name, time = r.time / 1000 })
 		end
+		table.sort(times, function(a, b)
+			if a.time ~= b.time then
+				return a.time > b.time
+			end
+			return a.name < b.name
+		end)
 
 		print = test.print
-		return numpassed, numfailed 
+		return numpassed, numfailed, times
 	end
-	